@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <SDL.h>
+
+#include <entities.hpp>
+#include <timers.hpp>
+#include <meta.hpp>
+#include <auxiliaries.hpp>
+
+
+namespace {
+    constexpr std::size_t kDefaultEntityCount = 10000;
+    constexpr int kDefaultFrameCount = 600;
+    constexpr Uint64 kFrameTicks = 16;   // Roughly 60 FPS, in milliseconds
+
+    Uint64 counter = 0;   // The source of `globals::frameClock`, advanced by exactly one frame per tick
+    std::vector<Slime*> slimes;   // In instantiation order, hence `slimes[i]` is of ID `i + 1`
+
+    /**
+     * @brief A level of `size` walkable tiles sharing the same collision level, hence every move within bounds is valid.
+    */
+    void loadLevel(SDL_Point const& size) {
+        level::data.tileDestCount = size;
+        level::data.tileDestSize = { 16, 16 };
+        level::data.collisionTilelayer.assign(size.y, std::vector<tile::GID>(size.x, 1));
+    }
+
+    /**
+     * @brief Respond to every slime as the player would, had it been within range: keep moving, towards the center of the level.
+     * @note Events are handed to their recipient directly rather than broadcast, which would cost `O(n^2)`.
+    */
+    void respond() {
+        const SDL_Point target = { level::data.tileDestCount.x / 2, level::data.tileDestCount.y / 2 };
+
+        for (auto code : { event::Code::kResp_MoveTerminate_GHE_Player, event::Code::kResp_MoveInitiate_GHE_Player }) {
+            for (std::size_t index = 0; index < slimes.size(); ++index) {
+                auto event = event::instantiate();
+                event::setID(event, static_cast<event::ID>(index + 1));
+                event::setCode(event, code);
+                event::setData(event, event::Data_Generic({ target, { 0, 0 }, EntitySecondaryStats() }));
+                slimes[index]->handleCustomEventGET(event);
+            }
+        }
+    }
+
+    /**
+     * @return A FNV-1a hash of every slime's position and animation frame. Stays constant across ticks only if slimes neither move nor animate.
+    */
+    std::uint64_t checksum() {
+        std::uint64_t hash = 14695981039346656037ull;
+        auto combine = [&](std::uint64_t value) { hash = (hash ^ value) * 1099511628211ull; };
+
+        for (auto slime : slimes) {
+            combine(static_cast<std::uint32_t>(slime->getDestRect().x));
+            combine(static_cast<std::uint32_t>(slime->getDestRect().y));
+            combine(slime->getAnimationFrame());
+        }
+
+        return hash;
+    }
+
+    /**
+     * @return The mean duration of the parallel part of `IngameInterface::handleEntitiesInteraction()` for slimes, in milliseconds per tick.
+     * @note Responses are delivered serially, outside of the measured section, as `IngameInterface::handleEvents()` would.
+    */
+    double measure(int frameCount) {
+        std::chrono::duration<double, std::milli> elapsed{};
+
+        for (int frame = 0; frame < frameCount; ++frame) {
+            counter += kFrameTicks;
+            globals::frameClock.tick();
+            globals::wheel.advance();   // As in `Game::startGameLoop()`, otherwise no movement delay nor animation timer ever expires
+            if (frame % 64 == 0) respond();   // Slimes otherwise keep their next velocity
+
+            const auto start = std::chrono::steady_clock::now();
+            Slime::invokeParallel(&Slime::move);
+            Slime::invokeParallel(&Slime::updateAnimation);
+            elapsed += std::chrono::steady_clock::now() - start;
+
+            globals::arena.reset();
+        }
+
+        return elapsed.count() / frameCount;
+    }
+}
+
+
+/**
+ * @brief Print the tick time of slime movement and animation against the number of job workers, headless.
+ * @param argv[1] the number of slimes. Defaults to `10000`.
+ * @param argv[2] the number of ticks per worker count. Defaults to `600`.
+ * @param argv[3] the largest worker count. Defaults to `config::game::jobWorkerCount()`.
+ * @note Must be run from the repository root, since the slime tileset is read from `assets/`. No window nor renderer is created.
+*/
+int main(int argc, char* argv[]) {
+    const std::size_t entityCount = argc > 1 ? std::max(std::atoi(argv[1]), 1) : kDefaultEntityCount;
+    const int frameCount = argc > 2 ? std::max(std::atoi(argv[2]), 1) : kDefaultFrameCount;
+    const std::size_t maxWorkerCount = argc > 3 ? std::max(std::atoi(argv[3]), 0) : config::game::jobWorkerCount();
+
+    globals::frameClock.setSource([]() { return counter; }, 1000);
+    globals::frameClock.tick();
+
+    // Slimes are spread one tile apart, so that they have room to move
+    const int side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(entityCount)))) * 2;
+    loadLevel({ side, side });
+
+    Slime::initialize();
+    for (std::size_t index = 0; index < entityCount; ++index) {
+        slimes.push_back(Slime::instantiate(SDL_Point{ static_cast<int>(index) % (side / 2) * 2, static_cast<int>(index) / (side / 2) * 2 }));
+        slimes.back()->onWindowChange();
+    }
+
+    std::printf("%zu slimes, %d ticks per worker count\n", entityCount, frameCount);
+    std::printf("initial checksum %016llx\n", static_cast<unsigned long long>(checksum()));
+    std::printf("%8s %12s %9s %18s\n", "workers", "ms/tick", "speedup", "checksum");
+
+    double baseline = 0;
+    for (std::size_t workerCount = 0; workerCount <= maxWorkerCount; ++workerCount) {
+        globals::jobs.initialize(workerCount);
+        measure(frameCount / 10 + 1);   // Warm-up
+        const double ticks = measure(frameCount);
+        globals::jobs.terminate();
+
+        if (!workerCount) baseline = ticks;
+        std::printf("%8zu %12.4f %8.2fx   %016llx\n", workerCount, ticks, baseline / ticks, static_cast<unsigned long long>(checksum()));
+    }
+
+    Slime::deinitialize();
+    globals::gc.clear();
+    return 0;
+}
@@ -0,0 +1,26 @@
+#include "multiton-entity.hpp"
+
+
+BenchEntity::BenchEntity(std::uint32_t seed) : mState(seed) {}
+
+/**
+ * @brief Advance a linear congruential generator, which is about as much work as an idle entity update.
+*/
+void BenchEntity::update() {
+    mState = mState * 1664525u + 1013904223u;
+}
+
+void BenchEntity::accumulate(std::uint64_t& sum) const {
+    sum += mState;
+}
+
+
+LegacyBenchEntity::LegacyBenchEntity(std::uint32_t seed) : mState(seed) {}
+
+void LegacyBenchEntity::update() {
+    mState = mState * 1664525u + 1013904223u;
+}
+
+void LegacyBenchEntity::accumulate(std::uint64_t& sum) const {
+    sum += mState;
+}
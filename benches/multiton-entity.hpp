@@ -0,0 +1,94 @@
+#ifndef BENCH_MULTITON_ENTITY_H
+#define BENCH_MULTITON_ENTITY_H
+
+#include <cstdint>
+#include <functional>
+#include <unordered_set>
+
+#include <meta.hpp>
+
+
+/**
+ * @brief A minimal `Multiton<T>` whose per-instance update is defined in a separate translation unit, as entity methods are, hence only inlinable into `Multiton<T>::invoke()` under `-flto`.
+*/
+class BenchEntity final : public Multiton<BenchEntity> {
+    public:
+        INCL_MULTITON(BenchEntity)
+
+        BenchEntity(std::uint32_t seed);
+        ~BenchEntity() = default;
+
+        void update();
+        void accumulate(std::uint64_t& sum) const;
+
+    private:
+        std::uint32_t mState;
+};
+
+
+/**
+ * @brief The meta-pattern layer prior to dropping virtual inheritance, kept as a baseline for `BenchEntity`.
+ * @note Mirrors the former `PolymorphicBase<T>` and `Multiton<T>`, down to the polymorphic destructors and the virtual base, which cost every instance its vtable pointers.
+*/
+namespace legacy {
+    template <typename T>
+    class PolymorphicBase {
+        public:
+            PolymorphicBase(PolymorphicBase const&) = delete;
+            PolymorphicBase& operator=(PolymorphicBase const&) = delete;
+            PolymorphicBase(PolymorphicBase&&) = delete;
+            PolymorphicBase& operator=(PolymorphicBase&&) = delete;
+
+        protected:
+            explicit PolymorphicBase() = default;
+            virtual ~PolymorphicBase() = default;
+    };
+
+    template <typename T>
+    class Multiton : virtual public PolymorphicBase<T> {
+        public:
+            template <typename... Args>
+            static T* instantiate(Args&&... args) {
+                auto instance = new T(std::forward<Args>(args)...);
+                instances.emplace(instance);
+                return instance;
+            }
+
+            template <typename Callable, typename... Args>
+            static void invoke(Callable&& callable, Args&&... args) {
+                if (instances.empty()) return;
+                for (auto& instance : instances) if (instance != nullptr) std::invoke(std::forward<Callable>(callable), *instance, std::forward<Args>(args)...);
+            }
+
+        protected:
+            virtual ~Multiton() {
+                instances.erase(reinterpret_cast<T*>(this));   // remove from `instances`
+            }
+
+            static std::unordered_set<T*> instances;
+    };
+
+    template <typename T>
+    std::unordered_set<T*> Multiton<T>::instances;
+}
+
+
+/**
+ * @brief `BenchEntity` over `legacy::Multiton<T>`, with identical members.
+*/
+class LegacyBenchEntity final : public legacy::Multiton<LegacyBenchEntity> {
+    public:
+        using legacy::Multiton<LegacyBenchEntity>::instantiate, legacy::Multiton<LegacyBenchEntity>::invoke, legacy::Multiton<LegacyBenchEntity>::instances;
+
+        LegacyBenchEntity(std::uint32_t seed);
+        ~LegacyBenchEntity() = default;
+
+        void update();
+        void accumulate(std::uint64_t& sum) const;
+
+    private:
+        std::uint32_t mState;
+};
+
+
+#endif
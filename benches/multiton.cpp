@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "multiton-entity.hpp"
+
+
+namespace {
+    constexpr std::size_t kInstanceCounts[] = { 16, 256, 4096, 65536 };
+    constexpr std::size_t kCallCount = 1 << 26;   // Per instance count, hence timings are comparable across instance counts
+    constexpr int kDefaultRepeatCount = 5;
+
+    struct Data_Result {
+        double perCall;   // In nanoseconds
+        std::uint64_t checksum;
+    };
+
+    /**
+     * @return The fastest of `repeatCount` runs of `T::invoke()` over `instanceCount` fresh instances of `T`, in nanoseconds per call.
+     * @note The fastest run is the least disturbed by the rest of the system, hence the most reproducible.
+     * @note Instances are heap-allocated one by one, as entities are. Both layouts fit the same allocator size class here, hence timings differ by the virtual bases rather than by the footprint.
+    */
+    template <typename T>
+    Data_Result measure(std::size_t instanceCount, int repeatCount) {
+        std::vector<T*> handles;
+        for (std::size_t index = 0; index < instanceCount; ++index) handles.push_back(T::instantiate(static_cast<std::uint32_t>(index)));
+
+        const std::size_t passCount = std::max<std::size_t>(kCallCount / instanceCount, 1);
+        T::invoke(&T::update);   // Warm-up
+
+        Data_Result result = {};
+        for (int repeat = 0; repeat < repeatCount; ++repeat) {
+            const auto start = std::chrono::steady_clock::now();
+            for (std::size_t pass = 0; pass < passCount; ++pass) T::invoke(&T::update);
+            const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+            const double perCall = elapsed.count() / (passCount * instanceCount);
+            if (!repeat || perCall < result.perCall) result.perCall = perCall;
+        }
+
+        T::invoke(&T::accumulate, result.checksum);   // Keeps updates observable, hence not optimized away
+        for (auto instance : handles) delete instance;   // Also removes it from `T::instances`
+
+        return result;
+    }
+}
+
+
+/**
+ * @brief Print the cost of `invoke()` per instance against the number of instances, for `BenchEntity` and for `LegacyBenchEntity`, i.e. without and with the former virtual meta-pattern bases.
+ * @param argv[1] the number of runs per instance count, of which the fastest is reported. Defaults to `5`.
+ * @note Built twice by `make bench`, with and without `-flto`, since `update()` is only inlined into `invoke()` across translation units with the former.
+*/
+int main(int argc, char* argv[]) {
+    const int repeatCount = argc > 1 ? std::max(std::atoi(argv[1]), 1) : kDefaultRepeatCount;
+
+    std::printf("%s: %zu calls per instance count, best of %d\n", argv[0], kCallCount, repeatCount);
+    std::printf("sizeof: %zu bytes (BenchEntity), %zu bytes (LegacyBenchEntity)\n", sizeof(BenchEntity), sizeof(LegacyBenchEntity));
+    std::printf("%10s %12s %12s %9s\n", "instances", "ns/call", "legacy", "speedup");
+
+    for (auto instanceCount : kInstanceCounts) {
+        const auto current = measure<BenchEntity>(instanceCount, repeatCount);
+        const auto legacy = measure<LegacyBenchEntity>(instanceCount, repeatCount);
+
+        std::printf("%10zu %12.3f %12.3f %8.2fx   (checksum %016llx)\n", instanceCount, current.perCall, legacy.perCall, legacy.perCall / current.perCall, static_cast<unsigned long long>(current.checksum));
+        if (current.checksum != legacy.checksum) {
+            std::printf("FAIL: checksums differ (legacy %016llx)\n", static_cast<unsigned long long>(legacy.checksum));
+            return 1;
+        }
+    }
+
+    return 0;
+}
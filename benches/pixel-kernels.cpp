@@ -0,0 +1,73 @@
+#include <pixel-kernels.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+
+namespace {
+    constexpr std::size_t kPixelCount = 1920 * 1080;
+    constexpr int kDefaultIterationCount = 64;
+
+    using Kernel = std::function<void(std::uint32_t*, std::size_t)>;
+
+    /**
+     * @return The throughput of `kernel` over `pixels`, in megapixels per second.
+     * @note A warm-up pass is run beforehand, so that page faults and cache misses of the first touch are not measured.
+    */
+    double measure(std::vector<std::uint32_t>& pixels, int iterationCount, Kernel const& kernel) {
+        kernel(pixels.data(), pixels.size());
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int iteration = 0; iteration < iterationCount; ++iteration) kernel(pixels.data(), pixels.size());
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        return static_cast<double>(pixels.size()) * iterationCount / elapsed.count() / 1e6;
+    }
+}
+
+
+/**
+ * @brief Print the throughput of each kernel on each backend supported by the CPU, over a 1080p frame worth of random pixels.
+ * @param argv[1] the number of timed passes per kernel and backend. Defaults to `64`.
+*/
+int main(int argc, char* argv[]) {
+    const int iterationCount = argc > 1 ? std::max(std::atoi(argv[1]), 1) : kDefaultIterationCount;
+    const auto selectedBackend = pixel::getBackend();
+
+    std::mt19937 rng(8964);
+    std::vector<std::uint32_t> source(kPixelCount);
+    for (auto& pixel : source) pixel = rng();
+
+    const std::pair<const char*, Kernel> kernels[] = {
+        { "grayscale", [](std::uint32_t* pixels, std::size_t count) { pixel::grayscale(pixels, count, 192); } },
+        { "tint", [](std::uint32_t* pixels, std::size_t count) { pixel::tint(pixels, count, { 0xff, 0x80, 0x40, 0xc0 }); } },
+        { "premultiplyAlpha", [](std::uint32_t* pixels, std::size_t count) { pixel::premultiplyAlpha(pixels, count); } },
+        { "colorKey", [](std::uint32_t* pixels, std::size_t count) { pixel::colorKey(pixels, count, { 0xff, 0x00, 0xff, SDL_ALPHA_OPAQUE }); } },
+    };
+
+    std::printf("%zu pixels, %d passes, selected backend: %s\n", kPixelCount, iterationCount, pixel::getBackendName(selectedBackend));
+    std::printf("%-18s", "kernel (MP/s)");
+    for (auto backend : pixel::getSupportedBackends()) std::printf("%12s", pixel::getBackendName(backend));
+    std::printf("\n");
+
+    for (auto const& [name, kernel] : kernels) {
+        std::printf("%-18s", name);
+        for (auto backend : pixel::getSupportedBackends()) {
+            auto pixels = source;   // Identical input per backend
+            pixel::setBackend(backend);
+            std::printf("%12.1f", measure(pixels, iterationCount, kernel));
+        }
+        std::printf("\n");
+    }
+
+    pixel::setBackend(selectedBackend);
+    return 0;
+}
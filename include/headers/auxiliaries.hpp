@@ -9,6 +9,9 @@
 #include <cstddef>
 #include <filesystem>
 #include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <list>
 #include <string>
@@ -25,6 +28,13 @@
 #include <pugixml/pugixml.hpp>
 
 #include <garbage-collector.hpp>
+#include <frame-arena.hpp>
+#include <command-buffer.hpp>
+#include <job-system.hpp>
+#include <sprite-batch.hpp>
+#include <render-queue.hpp>
+#include <render-command-buffer.hpp>
+#include <font-registry.hpp>
 
 
 /**
@@ -187,20 +197,122 @@ namespace tile {
     */
     using Tensor = std::vector<std::vector<Slice>>;
 
+    /**
+     * @brief Contain data associated with an animated tile i.e. a `<tile>` with an `<animation>` child in Tiled terminology.
+     * @param duration the sum of the durations of all frames, in milliseconds.
+     * @note Every occurrence of the animated GID shares the same phase, derived from the time elapsed since startup.
+     * @see https://doc.mapeditor.org/en/stable/reference/tmx-map-format/#animation
+    */
+    struct Data_TileAnimation {
+        struct Data_Frame {
+            GID gid;
+            unsigned int duration;   // In milliseconds
+        };
+
+        GID getFrame(unsigned int ticks) const;
+
+        std::vector<Data_Frame> frames;
+        unsigned int duration = 0;
+    };
+
+    using AnimationMap = std::unordered_map<GID, Data_TileAnimation>;
+
+    /**
+     * @brief Pack tileset images into a few large pages at runtime, so that sprites of different tilesets share textures and consecutive draws need not switch between them.
+     * @note Pages are packed via the skyline bottom-left heuristic. Each image is surrounded by `config::atlas::padding` pixels of its own extruded edges, preventing neighbouring images from bleeding in.
+     * @note Space is not reclaimed per image; a page is destroyed once every image packed into it has been released. Images are therefore packed into separate pools of pages by lifetime, so that long-lived images never pin pages shared with those released per level.
+     * @note Images that do not fit into an empty page are given standalone textures, owned by the atlas nonetheless.
+     * @note Recommended implementation: `clear()` should be called prior to the destruction of `globals::renderer`.
+    */
+    struct Data_Atlas {
+        /**
+         * @brief Pages of different pools are never shared.
+         * @param kLevel images released upon every level change e.g. tilelayer tilesets and their grayscaled copies.
+         * @param kEntity images that may outlive a level e.g. entity tilesets.
+        */
+        enum class Pool : unsigned char {
+            kLevel,
+            kEntity,
+        };
+
+        /**
+         * @param origin the position of the image within `texture`.
+         * @param page the index of the page the image is packed into, or `-1` if `texture` is standalone.
+        */
+        struct Data_Region {
+            SDL_Texture* texture = nullptr;
+            SDL_Point origin = { 0, 0 };
+            int page = -1;
+        };
+
+        /**
+         * @param imageCount the number of images currently in use.
+         * @param textureCount the number of textures backing said images i.e. pages and standalone textures. Without the atlas, both would be equal.
+        */
+        struct Data_Stats {
+            std::size_t imageCount = 0;
+            std::size_t textureCount = 0;
+            std::size_t pageCount = 0;
+            std::size_t usedArea = 0;
+            std::size_t totalArea = 0;
+        };
+
+        Data_Atlas() = default;
+        ~Data_Atlas() = default;
+
+        Data_Region insert(SDL_Surface* surface, SDL_Renderer* renderer, Pool pool = Pool::kLevel);
+        void release(Data_Region const& region);
+        void clear();
+
+        Data_Stats getStats() const;
+
+        private:
+            /**
+             * @brief A horizontal segment of the skyline i.e. the upper contour of packed images.
+            */
+            struct Data_Node {
+                int x, y, w;
+            };
+
+            struct Data_Page {
+                SDL_Texture* texture = nullptr;
+                std::vector<Data_Node> skyline;
+                std::size_t imageCount = 0;
+                std::size_t usedArea = 0;
+                Pool pool = Pool::kLevel;
+            };
+
+            std::optional<std::pair<std::size_t, SDL_Point>> fit(Data_Page const& page, SDL_Point const& size) const;
+            void place(Data_Page& page, std::size_t index, SDL_Rect const& rect);
+            int createPage(SDL_Renderer* renderer, Pool pool);
+
+            std::vector<Data_Page> mPages;   // Destroyed pages are kept as empty slots so that indices remain valid
+            SDL_Point mPageSize = { 0, 0 };
+            std::size_t mStandaloneCount = 0;
+    };
+
+    extern Data_Atlas atlas;
+
     /**
      * @brief Contain data associated with a generic tileset.
+     * @param srcOrigin the position of the tileset image within `texture`. Non-zero if packed into `tile::atlas`, hence source rects should be retrieved via methods that account for it.
      * @param properties maps the tileset's properties to their stringified values. Properties are Tiled standard types only e.g., `string`, `bool`, `int`. Registered values: `"norender"` prevents the tileset from being rendered; `"collision"` enables the tileset to be used in collision detection.
     */
     struct Data_Generic {
         std::string getProperty(std::string const& key);
         void setProperty(std::string const& key, std::string const& property);
 
-        void load(pugi::xml_document const& XMLTilesetData, SDL_Renderer* renderer);
+        void load(pugi::xml_document const& XMLTilesetData, SDL_Renderer* renderer, Data_Atlas::Pool pool = Data_Atlas::Pool::kLevel);
+        void loadTexture(SDL_Surface* surface, SDL_Renderer* renderer, Data_Atlas::Pool pool = Data_Atlas::Pool::kLevel);
         void clear();
 
-        SDL_Texture* texture;
-        SDL_Point srcCount;
-        SDL_Point srcSize;
+        static std::optional<std::filesystem::path> getImagePath(pugi::xml_document const& XMLTilesetData);
+
+        SDL_Texture* texture = nullptr;
+        SDL_Point srcOrigin = { 0, 0 };
+        int atlasPage = -1;
+        SDL_Point srcCount = { 0, 0 };
+        SDL_Point srcSize = { 0, 0 };
         std::unordered_map<std::string, std::string> properties;
     };
 
@@ -210,9 +322,26 @@ namespace tile {
      * @see <globals.h> tile::BaseTilesetData
     */
     struct Data_TilelayerTileset : public Data_Generic {
-        void load(json const& JSONTileLayerData, SDL_Renderer* renderer);   // Does not override
+        void load(json const& JSONTileLayerData, SDL_Renderer* renderer, AnimationMap* animations = nullptr);   // Does not override
+        bool loadGrayscale(SDL_Renderer* renderer, unsigned int intensity);
+        void clear();   // Does not override
+
+        /**
+         * @return The source rect of `gid` within `texture`, or within `grayscale.texture` if `isGrayscale` is set. Requires `gid` to belong to the tileset.
+        */
+        inline SDL_Rect getSrcRect(GID gid, bool isGrayscale = false) const {
+            auto const& origin = isGrayscale ? grayscale.origin : srcOrigin;
+            return {
+                origin.x + (gid - firstGID) % srcCount.x * srcSize.x,
+                origin.y + (gid - firstGID) / srcCount.x * srcSize.y,
+                srcSize.x,
+                srcSize.y,
+            };
+        }
 
         GID firstGID = 0;
+        std::filesystem::path imagePath;
+        Data_Atlas::Data_Region grayscale;   // A grayscaled copy of the image, packed into `tile::atlas` on demand
     };
 
     /**
@@ -222,17 +351,38 @@ namespace tile {
     */
     struct Data_TilelayerTilesets {
         void load(json const& JSONLevelData, SDL_Renderer* renderer);
+        bool loadGrayscale(SDL_Renderer* renderer, unsigned int intensity);
         std::optional<Data_TilelayerTileset> operator[](GID gid) const;
+        Data_TilelayerTileset const* find(GID gid) const;
+
+        inline AnimationMap const& getAnimations() const { return mAnimations; }
 
         private:
             std::vector<Data_TilelayerTileset> mData;
+            AnimationMap mAnimations;   // Animated tiles of every tileset, keyed by GID
+            std::optional<bool> mIsGrayscaleLoaded;   // The result of the first `loadGrayscale()` call since `load()`
+    };
+
+    /**
+     * @brief A non-empty, renderable tile of a tilelayer, resolved ahead of time.
+     * @param tileset points into `level::data.tilesets`, hence is valid until the next level load.
+     * @param srcRect the source rect of `gid` within `tileset->texture`.
+    */
+    struct Data_TileDraw {
+        Data_TilelayerTileset const* tileset = nullptr;
+        SDL_Rect srcRect;
+        SDL_Point tileCoords;
+        GID gid;
     };
+
+    using DrawList = std::vector<Data_TileDraw>;
     
     /**
      * @brief Contain data associated with a tileset for an entity or an animated object.
      * @param animationMapping maps an animation type to the associated data.
      * @param animationTicks the number of frames a sprite should last before switching to the next. Should be treated as a constant.
      * @param animationSize represents the ratio between the size of one single animation/sprite and the size of a `Tile` on the tileset, per dimension. Should be implemented alongside `globals::tileDestSize`.
+     * @note Animations are compiled upon loading into a flat table indexed by (animation, direction, frame), hence stepping through an animation requires no hashing nor arithmetics.
      * @note `clear()` method unnecessary since its lifespan (and its dependencies') should persist along with an `AbstractAnimatedEntity<T>`-derived as a static member.
     */
     struct Data_EntityTileset : public Data_Generic {
@@ -273,6 +423,59 @@ namespace tile {
             }
         }
 
+        static constexpr unsigned int kAnimationCount = 7;
+        static constexpr unsigned int kDirectionCount = 4;
+
+        /**
+         * @return An index in range `[0, kAnimationCount)`, or `kAnimationCount` if `animation` is not registered.
+        */
+        static inline constexpr unsigned int getAnimationIndex(Animation animation) {
+            switch (animation) {
+                case Animation::kIdle: return 0;
+                case Animation::kWalk: return 1;
+                case Animation::kRun: return 2;
+                case Animation::kAttackMeele: return 3;
+                case Animation::kAttackRanged: return 4;
+                case Animation::kDamaged: return 5;
+                case Animation::kDeath: return 6;
+                default: return kAnimationCount;
+            }
+        }
+
+        /**
+         * @return An index in range `[0, kDirectionCount)` i.e. east, west, south, north, or `kDirectionCount` if `direction` is not a unit vector along one axis.
+        */
+        static inline constexpr unsigned int getDirectionIndex(SDL_Point const& direction) {
+            if (!direction.y) return direction.x == 1 ? 0 : direction.x == -1 ? 1 : kDirectionCount;
+            if (!direction.x) return direction.y == 1 ? 2 : direction.y == -1 ? 3 : kDirectionCount;
+            return kDirectionCount;
+        }
+
+        /**
+         * Register animation events i.e. tags attached to specific frames of an animation, emitted when said frames are entered.
+        */
+        enum class Event : unsigned char {
+            kNone,
+            kFootstep,
+            kAttack,
+            kDamaged,
+            kDeath,
+        };
+
+        static inline constexpr Event getEvent(Animation animation) {
+            switch (animation) {
+                case Animation::kWalk:
+                case Animation::kRun:
+                    return Event::kFootstep;
+
+                case Animation::kAttackMeele: return Event::kAttack;
+                case Animation::kDamaged: return Event::kDamaged;
+                case Animation::kDeath: return Event::kDeath;
+
+                default: return Event::kNone;
+            }
+        }
+
         static inline constexpr bool getContinuity(Animation animation) {
             switch (animation) {
                 case Animation::kIdle:
@@ -289,7 +492,9 @@ namespace tile {
          * 
          * @param startGID the first `GID` of the animation. Defaults to `0`.
          * @param stopGID the last `GID` of the animation. Defaults to `0`.
-         * @param isPermanent specifies whether the animation should be a loop i.e. whether external calls should be performed when the animation reaches its end. Defaults to `false`.
+         * @param eventFrames a bitmask of the frames tagged with the animation's `Event`, registered via the `"event-frames"` property e.g. `"0,3"`. Defaults to the first frame, and also the middle frame for continuous animations. Only the first 32 frames could be tagged.
+         * @param frameOffset the index of the first frame of the animation in the compiled frame table.
+         * @param frameCount the number of frames of the animation. `0` if the animation has not been compiled.
         */
         struct Data_Animation {
             void load(pugi::xml_node const& XMLAnimationNode);
@@ -297,28 +502,125 @@ namespace tile {
             int startGID = 0;
             int stopGID = 0;
             double ticksMultiplier = 1;
+
+            std::optional<std::uint32_t> eventFrames;
+
+            unsigned int frameOffset = 0;
+            unsigned int frameCount = 0;
+        };
+
+        /**
+         * @brief Contain data associated with a single sprite of an animation.
+         * @param ticks the duration of the sprite, in milliseconds.
+        */
+        struct Data_Frame {
+            SDL_Rect srcRect;
+            unsigned int ticks;
+            Event event;
         };
 
         static constexpr SDL_Point kDefaultDirection = { 1, 0 };
 
         void load(pugi::xml_document const& XMLTilesetData, SDL_Renderer* renderer);
+        void loadTexture(SDL_Surface* surface, SDL_Renderer* renderer);   // Does not override
         Data_Animation const& at(Animation animation, SDL_Point const& direction = kDefaultDirection) const;
 
+        /**
+         * @return The `index`-th frame of `animation`, or `nullptr` if out of bounds.
+        */
+        inline Data_Frame const* getFrame(Data_Animation const& animation, unsigned int index) const {
+            return index < animation.frameCount ? &mFrames[animation.frameOffset + index] : nullptr;
+        }
+
+        Data_Frame const* getFrameAtPhase(Data_Animation const& animation, unsigned int ticks) const;
+
         unsigned int animationTicks = 1000;
         SDL_Point animationSize = { 1, 1 };
         bool isMultiDirectional = false;
 
         private:
-            struct hash {
-                std::size_t operator()(std::pair<Animation, SDL_Point> const& instance) const;
+            void loadProperties(pugi::xml_document const& XMLTilesetData);
+            void compileAnimations();
+
+            std::array<Data_Animation, kAnimationCount * kDirectionCount> mAnimations;
+            std::vector<Data_Frame> mFrames;
+    };
+
+    /**
+     * @brief Contain data associated with an emitted animation event.
+     * @param isPlayerSource specifies whether the event is emitted by `Player`.
+    */
+    struct Data_AnimationEvent {
+        Data_EntityTileset::Event event;
+        Data_EntityTileset::Animation animation;
+        bool isPlayerSource;
+    };
+
+    /**
+     * @brief A fixed-capacity FIFO ring buffer of `Data_AnimationEvent`. Never allocates.
+     * @note Events pushed beyond `kCapacity` are dropped.
+    */
+    struct Data_AnimationEventQueue {
+        static constexpr std::size_t kCapacity = 64;
+
+        bool push(Data_AnimationEvent const& event);
+        std::optional<Data_AnimationEvent> pop();
+        void clear();
+
+        private:
+            std::array<Data_AnimationEvent, kCapacity> mData;
+            std::size_t mHead = 0;
+            std::size_t mSize = 0;
+            std::mutex mMutex;   // Animations might be updated from `globals::jobs` workers
+    };
+
+    /**
+     * @brief A process-wide cache of `Data_EntityTileset`, keyed by the path of the `.tsx` file.
+     * @note Cached tilesets are shared and should be treated as immutable. Switching between variants of the same entity e.g. player skins is therefore reduced to a pointer swap after the first load.
+     * @note A tileset is in use as long as it is referenced outside of the cache. Unused tilesets are evicted in least-recently-used order whenever the total texture memory exceeds `config::entities::tilesetMemoryBudget`.
+     * @note Recommended implementation: `clear()` should be called prior to the destruction of `globals::renderer`.
+    */
+    struct Data_EntityTilesetCache {
+        Data_EntityTilesetCache() = default;
+        ~Data_EntityTilesetCache() = default;
+
+        std::shared_ptr<const Data_EntityTileset> get(std::filesystem::path const& path, SDL_Renderer* renderer);
+        void prefetch(std::filesystem::path const& path);
+        void trim(std::size_t budget);
+        void clear();
+
+        inline std::size_t getTextureMemory() const { return mTextureMemory; }
+
+        private:
+            /**
+             * @param textureMemory the estimated size of the texture, in bytes.
+             * @param lastAccess the value of `mAccessCounter` upon the latest call to `get()`.
+            */
+            struct Data_Entry {
+                std::shared_ptr<const Data_EntityTileset> data;
+                std::size_t textureMemory = 0;
+                unsigned long long int lastAccess = 0;
             };
-            
-            struct equal_to {
-                bool operator()(std::pair<Animation, SDL_Point> const& first, std::pair<Animation, SDL_Point> const& second) const;
+
+            /**
+             * @brief Contain everything of a `Data_EntityTileset` that could be loaded off the main thread, i.e. all but the texture.
+            */
+            struct Data_Staged {
+                Data_EntityTileset data;
+                SDL_Surface* surface = nullptr;
             };
 
-            std::unordered_map<std::pair<Animation, SDL_Point>, Data_Animation, hash, equal_to> mUMap;
+            static Data_Staged stage(std::filesystem::path const& path);
+
+            std::unordered_map<std::string, Data_Entry> mUMap;
+            std::unordered_map<std::string, std::future<Data_Staged>> mPending;
+
+            std::size_t mTextureMemory = 0;
+            unsigned long long int mAccessCounter = 0;
     };
+
+    extern Data_EntityTilesetCache cache;
+    extern Data_AnimationEventQueue events;
 }
 
 
@@ -402,7 +704,7 @@ namespace level {
         Data() = default;
         ~Data() { clear(); }
 
-        std::vector<Data_Generic*> get(std::string const& key);
+        std::pmr::vector<Data_Generic*> get(std::string const& key);
         void insert(std::string const& key, Data_Generic* data);
         void erase(std::string const& key);
 
@@ -413,11 +715,13 @@ namespace level {
         void eraseProperty(std::string const& key);
 
         void load(json const& JSONLevelData);
+        void loadDrawList(SDL_Point const& chunkCoords);
         void clear();
 
         tile::Tensor tiles;
         tile::Data_TilelayerTilesets tilesets;
         std::vector<std::vector<tile::GID>> collisionTilelayer;
+        std::vector<std::vector<tile::DrawList>> drawLists;   // Indexed by chunk of `config::interface::mapChunkTileCount` tiles per dimension in row-major order, then by tilelayer
 
         SDL_Point tileDestSize;
         SDL_Point tileDestCount;
@@ -433,9 +737,24 @@ namespace level {
             void loadTileLayer(json const& JSONLayerData);
             void loadObjectLayer(json const& JSONLayerData);
             void loadTilelayerTilesets(json const& JSONLevelData);
+            void loadDrawLists();
+    };
+
+    /**
+     * @brief Map level coordinates to window coordinates. Assigned by `IngameViewHandler` once per frame, prior to rendering in-game dependencies.
+     * @param viewport the portion of the level, in level coordinates, presented on screen.
+     * @param destRect the portion of the window, in window coordinates, `viewport` is stretched onto.
+    */
+    struct Data_Camera {
+        bool isVisible(SDL_Rect const& rect) const;
+        SDL_Rect project(SDL_Rect const& rect) const;
+
+        SDL_Rect viewport{};
+        SDL_Rect destRect{};
     };
 
     extern Data data;
+    extern Data_Camera camera;
 }
 
 
@@ -497,22 +816,14 @@ namespace event {
     void initialize();
 
     SDL_Event instantiate();
-    void terminate(SDL_Event const& event);
     void enqueue(SDL_Event& event);
+    void* allocate(std::size_t bytes, std::size_t alignment);
 
     event::ID getID(SDL_Event const& event);
     void setID(SDL_Event& event, event::ID id);
     event::Code getCode(SDL_Event const& event);
     void setCode(SDL_Event& event, event::Code code);
 
-    /**
-     * Helper function. Not meant to be used outside of namespace.
-    */
-    template <typename Data>
-    inline void __deallocate__(SDL_Event const& event) {
-        if (event.user.data1 != nullptr) delete reinterpret_cast<Data*>(event.user.data1);
-    }
-
     /**
      * @note Should only be called when `event.user.data1` is not `nullptr`.
     */
@@ -523,11 +834,12 @@ namespace event {
 
     /**
      * @note Assumes that `event.user.data1`, for its entire lifespan, is of type `Data`.
+     * @note Allocated from `globals::arena`, hence `event` should be handled within the current frame.
     */
     template <typename Data>
     inline void setData(SDL_Event& event, Data const& data) {
-        if (event.user.data1 != nullptr) delete reinterpret_cast<Data*>(event.user.data1);
-        event.user.data1 = new Data(data);
+        static_assert(std::is_trivially_destructible_v<Data>, "Payloads are never destructed");
+        event.user.data1 = new (allocate(sizeof(Data), alignof(Data))) Data(data);
     }
 }
 
@@ -584,6 +896,28 @@ namespace config {
         }
     }
 
+    namespace atlas {
+        constexpr int pageSize = 2048;   // Clamped to the maximum texture size supported by the renderer
+        constexpr int padding = 1;
+    }
+
+    /**
+     * Layers of `globals::batch`, flushed in ascending order. Tilelayers are batched separately, by their index.
+    */
+    namespace batch {
+        constexpr int mapLayer = 0;
+        constexpr int entityLayer = 1;
+        constexpr int textLayer = 2;
+    }
+
+    namespace text {
+        /**
+         * Glyphs are rasterized into square pages of `glyphAtlasPageSize` pixels. Up to `layoutCacheCapacity` laid out strings are retained per font, beyond which the cache is emptied.
+        */
+        constexpr int glyphAtlasPageSize = 512;
+        constexpr std::size_t layoutCacheCapacity = 256;
+    }
+
     namespace color {
         constexpr SDL_Color offwhite = SDL_Color{ 0xf2, 0xf3, 0xf4, SDL_ALPHA_OPAQUE };
         constexpr SDL_Color offblack = { 0x14, 0x14, 0x12, SDL_ALPHA_OPAQUE };
@@ -616,6 +950,8 @@ namespace config {
 
     namespace game {
         constexpr int FPS = 60;
+        constexpr std::size_t frameArenaCapacity = 1 << 20;   // In bytes. Exceeding allocations fall back to the heap
+        std::size_t jobWorkerCount();
         const std::filesystem::path windowIconPath = config::path::asset / "icon/light.png";
 
         const std::tuple<GameInitFlag, SDL_Rect, int, std::string> initializer = {
@@ -654,6 +990,14 @@ namespace config {
         constexpr int idleFrames = 16;
         constexpr std::size_t LRUCacheSize = 64;
 
+        /**
+         * The level is baked into square chunks of `mapChunkTileCount` tiles per dimension. Chunks within `mapChunkPrefetchMargin` chunks of the viewport are baked ahead of time, at most `mapChunkPrefetchCount` per frame. Chunks out of view are evicted in least-recently-used order beyond `mapChunkMemoryBudget`.
+        */
+        constexpr int mapChunkTileCount = 16;
+        constexpr int mapChunkPrefetchMargin = 1;
+        constexpr int mapChunkPrefetchCount = 1;
+        constexpr std::size_t mapChunkMemoryBudget = 64 << 20;   // In bytes
+
         constexpr double viewportHeight = 18;   // OMORI's white space
         constexpr double grayscaleIntensity = 1;
     }
@@ -664,7 +1008,23 @@ namespace config {
     namespace entities {
         constexpr double runVelocityModifier = 4;
         constexpr SDL_FRect destRectModifier = { 0, 0, 1, 1 };
-        constexpr unsigned int SFXTicks = 777;
+        constexpr std::size_t tilesetMemoryBudget = 64 << 20;   // In bytes. Unused tilesets are evicted beyond this threshold
+
+        /**
+         * Layers of `globals::renderQueue`. Within a layer, entities are drawn in order of the bottom edge of their sprites.
+        */
+        namespace layer {
+            constexpr unsigned int standard = 0;
+            constexpr unsigned int projectile = 1;
+        }
+
+        /**
+         * Per-frame limits shared by the spawn queues of all entity types. Whichever is reached first ends spawning for the current frame.
+        */
+        namespace spawn {
+            constexpr unsigned int countBudget = 8;
+            constexpr double timeBudget = 2;   // In milliseconds
+        }
         
         namespace player {
             constexpr const char* typeID = "player";
@@ -691,6 +1051,7 @@ namespace config {
                 "assets/.tiled/.tsx/player-premade-20.tsx",
             };
             const std::filesystem::path path = paths[0];
+            constexpr bool prefetchAdjacentPaths = true;   // Load the previous and next premade tilesets in the background
             constexpr SDL_FRect destRectModifier = { 0, -1.125, 1, 1 };
             constexpr SDL_FPoint velocity = { 16, 16 };
             constexpr unsigned int moveDelayTicks = 0;
@@ -934,6 +1295,13 @@ namespace globals {
     extern GameState state;
 
     extern GarbageCollector gc;
+    extern FrameArena arena;
+    extern CommandBuffer commands;
+    extern JobSystem jobs;
+    extern SpriteBatch batch;
+    extern RenderQueue renderQueue;
+    extern RenderCommandBuffer renderCommands;
+    extern FontRegistry fonts;
 }
 
 
@@ -1037,6 +1405,7 @@ namespace utils {
 
     SDL_Texture* duplicateTexture(SDL_Renderer* renderer, SDL_Texture* texture);
     SDL_Texture* createGrayscaleTexture(SDL_Renderer* renderer, SDL_Texture* texture, double intensity = 1);
+    std::size_t getTextureMemory(SDL_Texture* texture);
     void setTextureRGB(SDL_Texture* texture, SDL_Color const& color);
     void setTextureRGBA(SDL_Texture* texture, SDL_Color const& color);
 
@@ -0,0 +1,70 @@
+#ifndef COMMAND_BUFFER_H
+#define COMMAND_BUFFER_H
+
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+
+/**
+ * @brief Record structural changes i.e. entity spawns and despawns, to be applied in one batch at a sync point.
+ * @note Recording is thread-safe, hence update passes over the instances of a type might run in parallel, and might spawn or despawn mid-iteration.
+ * @note Commands are applied in the order they are recorded. Commands recorded during `apply()` are deferred to the next call.
+*/
+class CommandBuffer final {
+    public:
+        CommandBuffer() = default;
+        ~CommandBuffer() = default;
+
+        /**
+         * @brief Record the instantiation of `T` with `args`. Arguments are copied.
+        */
+        template <typename T, typename... Args>
+        inline void spawn(Args&&... args) {
+            record([args = std::make_tuple(std::forward<Args>(args)...)]() { T::instantiate(args); });
+        }
+
+        /**
+         * @brief Record the removal of `instance`. Recording the same instance multiple times is harmless.
+        */
+        template <typename T>
+        inline void despawn(T* instance) {
+            record([instance]() { T::despawn(instance); });
+        }
+
+        /**
+         * @note Recommended implementation: this method should be called from the main thread only, when no update pass is running.
+        */
+        inline void apply() {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mApplied.swap(mRecorded);
+            }
+
+            for (auto& command : mApplied) command();
+            mApplied.clear();
+        }
+
+        /**
+         * @brief Discard pending commands e.g. upon level change.
+        */
+        inline void clear() {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRecorded.clear();
+        }
+
+    private:
+        template <typename Callable>
+        inline void record(Callable&& callable) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRecorded.emplace_back(std::forward<Callable>(callable));
+        }
+
+        std::mutex mMutex;
+        std::vector<std::function<void()>> mRecorded;
+        std::vector<std::function<void()>> mApplied;   // Kept around to reuse its capacity
+};
+
+
+#endif
@@ -1,27 +1,28 @@
 #ifndef COMPONENTS_H
 #define COMPONENTS_H
 
+#include <array>
 #include <string>
 #include <functional>
 #include <filesystem>
-#include <map>
 #include <unordered_map>
 #include <type_traits>
 #include <queue>
+#include <vector>
 
 #include <SDL.h>
 #include <SDL_ttf.h>
 
 #include <meta.hpp>
 #include <auxiliaries.hpp>
+#include <glyph-atlas.hpp>
 
 
 /* Abstract templates */
 
 /**
  * @brief Represent an abstract component. Does nothing by default.
- * @note Recommended implementation: beware of virtual inheritance! Since this is a virtual base class and this constructor requires passing parameters, all derived classes are required to explicitly call this constructor.
- * @see https://stackoverflow.com/questions/1193138/virtual-base-class-data-members/1193516#1193516
+ * @note Recommended implementation: `GenericBoxComponent<T>` and `GenericTextComponent<T>` are stacked on top of this class via their `Base` parameter instead of virtual inheritance, hence only the immediate base constructor should be called.
 */
 template <typename T>
 class GenericComponent : public Multiton<T> {
@@ -57,8 +58,12 @@ namespace std {
 #define INCL_GENERIC_COMPONENT(T) using GenericComponent<T>::onWindowChange, GenericComponent<T>::sDestSize, GenericComponent<T>::kDestSizeModifier, GenericComponent<T>::kDestRectRatio, GenericComponent<T>::kCenter, GenericComponent<T>::kPreset;
 
 
-template <typename T>
-class GenericBoxComponent : virtual public GenericComponent<T> {
+/**
+ * @brief Represent a component that renders a box.
+ * @note `Base` is either `GenericComponent<T>` or another component layer e.g. `GenericTextComponent<T>`, in which case `onWindowChange()` also covers that of `Base`. This replaces the previous diamond of virtual bases.
+*/
+template <typename T, typename Base = GenericComponent<T>>
+class GenericBoxComponent : public Base {
     public:
         INCL_MULTITON(T)
         INCL_GENERIC_COMPONENT(T)
@@ -69,7 +74,11 @@ class GenericBoxComponent : virtual public GenericComponent<T> {
         void onWindowChange() override;
 
     protected:
-        GenericBoxComponent(SDL_FPoint const& center, ComponentPreset const& preset);
+        /**
+         * @note Trailing arguments, if any, are forwarded to the constructor of `Base`. Defined here since member templates are not covered by explicit template instantiation.
+        */
+        template <typename... Args>
+        GenericBoxComponent(SDL_FPoint const& center, ComponentPreset const& preset, Args&&... args) : Base(center, preset, std::forward<Args>(args)...) {}
 
         static void shrinkRect(SDL_Rect& rect, const float ratio);
         void loadBoxTexture(SDL_Texture*& texture, ComponentPreset const& preset);
@@ -78,11 +87,18 @@ class GenericBoxComponent : virtual public GenericComponent<T> {
         SDL_Rect mBoxDestRect;
 };
 
-#define INCL_GENERIC_BOX_COMPONENT(T) using GenericBoxComponent<T>::render, GenericBoxComponent<T>::onWindowChange, GenericBoxComponent<T>::shrinkRect, GenericBoxComponent<T>::loadBoxTexture, GenericBoxComponent<T>::mBoxTexture, GenericBoxComponent<T>::mBoxDestRect;
+/**
+ * @note Variadic to allow passing the `Base` parameter e.g. `INCL_GENERIC_BOX_COMPONENT(T, GenericTextComponent<T>)`.
+*/
+#define INCL_GENERIC_BOX_COMPONENT(...) using GenericBoxComponent<__VA_ARGS__>::render, GenericBoxComponent<__VA_ARGS__>::onWindowChange, GenericBoxComponent<__VA_ARGS__>::shrinkRect, GenericBoxComponent<__VA_ARGS__>::loadBoxTexture, GenericBoxComponent<__VA_ARGS__>::mBoxTexture, GenericBoxComponent<__VA_ARGS__>::mBoxDestRect;
 
 
+/**
+ * @brief Represent a generic text component.
+ * @note Text is drawn as glyph quads from `sGlyphAtlas`, shared by every component using the same font and size via `globals::fonts`, into `config::batch::textLayer` of `globals::batch` i.e. on top of unbatched draws of the same frame. Editing content therefore costs no rasterization for glyphs already encountered.
+*/
 template <typename T>
-class GenericTextComponent : virtual public GenericComponent<T> {
+class GenericTextComponent : public GenericComponent<T> {
     public:
         INCL_MULTITON(T)
         INCL_GENERIC_COMPONENT(T)
@@ -99,30 +115,34 @@ class GenericTextComponent : virtual public GenericComponent<T> {
     protected:  
         GenericTextComponent(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content);
 
-        void loadTextTexture(SDL_Texture*& texture, ComponentPreset const& preset);
+        void loadTextLayout();
+        void renderText(ComponentPreset const& preset) const;
 
-        static TTF_Font* sFont;
+        static TTF_Font* sFont;   // Acquired from `globals::fonts`
+        static GlyphAtlas* sGlyphAtlas;
+        static int sFontSize;
         static const std::filesystem::path sFontPath;
 
-        SDL_Texture* mTextTexture = nullptr;
         SDL_Rect mTextDestRect;
+        Uint8 mTextAlpha = SDL_ALPHA_OPAQUE;   // Modulates the alpha of the preset text color
 
         std::string mContent;
 };
 
-#define INCL_GENERIC_TEXT_COMPONENT(T) using GenericTextComponent<T>::deinitialize, GenericTextComponent<T>::render, GenericTextComponent<T>::onWindowChange, GenericTextComponent<T>::editContent, GenericTextComponent<T>::loadTextTexture, GenericTextComponent<T>::sFont, GenericTextComponent<T>::sFontPath, GenericTextComponent<T>::mTextTexture, GenericTextComponent<T>::mTextDestRect, GenericTextComponent<T>::mContent;
+#define INCL_GENERIC_TEXT_COMPONENT(T) using GenericTextComponent<T>::deinitialize, GenericTextComponent<T>::render, GenericTextComponent<T>::onWindowChange, GenericTextComponent<T>::editContent, GenericTextComponent<T>::loadTextLayout, GenericTextComponent<T>::renderText, GenericTextComponent<T>::sFont, GenericTextComponent<T>::sGlyphAtlas, GenericTextComponent<T>::sFontSize, GenericTextComponent<T>::sFontPath, GenericTextComponent<T>::mTextDestRect, GenericTextComponent<T>::mTextAlpha, GenericTextComponent<T>::mContent;
 
 
 /**
  * @brief A text-inside-a-box component, essentially the combination of `GenericTextComponent<T>` and `GenericBoxComponent<T>`.
+ * @note Linearized as `GenericBoxComponent<T, GenericTextComponent<T>>` i.e. a single chain of non-virtual bases.
 */
 template <typename T>
-class GenericTextBoxComponent : public GenericTextComponent<T>, public GenericBoxComponent<T> {
+class GenericTextBoxComponent : public GenericBoxComponent<T, GenericTextComponent<T>> {
     public:
         INCL_MULTITON(T)
         INCL_GENERIC_COMPONENT(T)
         INCL_GENERIC_TEXT_COMPONENT(T)
-        INCL_GENERIC_BOX_COMPONENT(T)
+        INCL_GENERIC_BOX_COMPONENT(T, GenericTextComponent<T>)
 
         virtual ~GenericTextBoxComponent() = default;
 
@@ -147,7 +167,7 @@ class GenericButtonComponent : public GenericTextBoxComponent<T> {
         INCL_MULTITON(T)
         INCL_GENERIC_COMPONENT(T)
         INCL_GENERIC_TEXT_COMPONENT(T)
-        INCL_GENERIC_BOX_COMPONENT(T)
+        INCL_GENERIC_BOX_COMPONENT(T, GenericTextComponent<T>)
         INCL_GENERIC_TEXTBOX_COMPONENT(T)
 
         virtual ~GenericButtonComponent() = default;
@@ -167,7 +187,6 @@ class GenericButtonComponent : public GenericTextBoxComponent<T> {
         virtual void onClick();
 
         const ComponentPreset kOnMouseOverPreset;
-        SDL_Texture* mTextTextureOnMouseOver = nullptr;
         SDL_Texture* mBoxTextureOnMouseOver = nullptr;
 
         const GameState* kTargetGameState = nullptr;
@@ -181,7 +200,7 @@ class GenericButtonComponent : public GenericTextBoxComponent<T> {
         bool mIsMouseOut = true;
 };
 
-#define INCL_GENERIC_BUTTON_COMPONENT(T) using GenericButtonComponent<T>::initialize, GenericButtonComponent<T>::deinitialize, GenericButtonComponent<T>::render, GenericButtonComponent<T>::onWindowChange, GenericButtonComponent<T>::handleMouseEvent, GenericButtonComponent<T>::handleCursor, GenericButtonComponent<T>::onClick, GenericButtonComponent<T>::kOnMouseOverPreset, GenericButtonComponent<T>::mTextTextureOnMouseOver, GenericButtonComponent<T>::mBoxTextureOnMouseOver, GenericButtonComponent<T>::kTargetGameState;
+#define INCL_GENERIC_BUTTON_COMPONENT(T) using GenericButtonComponent<T>::initialize, GenericButtonComponent<T>::deinitialize, GenericButtonComponent<T>::render, GenericButtonComponent<T>::onWindowChange, GenericButtonComponent<T>::handleMouseEvent, GenericButtonComponent<T>::handleCursor, GenericButtonComponent<T>::onClick, GenericButtonComponent<T>::kOnMouseOverPreset, GenericButtonComponent<T>::mBoxTextureOnMouseOver, GenericButtonComponent<T>::kTargetGameState;
 
 
 template <typename T>
@@ -277,31 +296,28 @@ class IngameDialogueBox : public Singleton<IngameDialogueBox>, public GenericBox
         kUpdateComplete,
     };
     
+    /**
+     * @brief A bitmap font pre-rendered from a `TTF_Font` into a single texture.
+     * @note Glyphs are looked up in a flat table indexed by byte, compiled upon `load()`. Text is laid out once per line via `layout()`, then revealed incrementally via `reveal()`, which only queues glyphs not yet rendered.
+    */
     class BMPFont {
-        struct Data_Glyph_Storage {
-            int width;
-            int advance;
-        };
-
-        struct Data_Glyph_Query {
-            SDL_Rect srcRect;
-            int advance;
+        /**
+         * @param srcRect within `mTexture`. Zero-width if the glyph is not provided by the font.
+         * @param advance the distance between the origins of this glyph and the next one.
+        */
+        struct Data_Glyph {
+            SDL_Rect srcRect{};
+            int advance = 0;
         };
 
-        class Map {
-            public:
-                Map() = default;
-                inline ~Map() { clear(); }
-
-                void insert(char c, Data_Glyph_Storage const& data);
-                inline void clear() { mGlyphDataUMap.clear(); }
-                Data_Glyph_Query operator[](char c) const;
-
-                inline void setGlyphHeight(int height) { mGlyphHeight = height; }
-
-            private:
-                int mGlyphHeight;
-                std::map<char, Data_Glyph_Storage> mGlyphDataUMap;
+        /**
+         * @brief The placement of a char of the current line within `mTargetTexture`.
+         * @param isPageBreak whether `mTargetTexture` should be cleared prior to rendering this char, as previous ones no longer fit.
+        */
+        struct Data_Placement {
+            SDL_Rect srcRect{};
+            SDL_Rect destRect{};
+            bool isPageBreak = false;
         };
 
         public:
@@ -309,16 +325,19 @@ class IngameDialogueBox : public Singleton<IngameDialogueBox>, public GenericBox
             ~BMPFont();
 
             void load(TTF_Font* font);
-            void clear() const;
-            void render(char c) const;
+            void clear();
+            void layout(std::string const& text);
+            void reveal(std::size_t count) const;
+            void flush() const;
 
             void setRenderTarget(SDL_Texture*& targetTexture);
             inline void setSpacing(SDL_Point spacing) { mSpacing = spacing; }
 
         private:
             std::string getChars() const;
-            void registerCharToMap(TTF_Font* font, char c);
+            void registerCharToTable(TTF_Font* font, char c);
             void registerCharToTexture(TTF_Font* font, char c) const;
+            void clearTarget() const;
 
             #if defined(__linux__)
             static constexpr auto sTextRenderMethod = TTF_RenderGlyph32_Shaded;
@@ -328,13 +347,16 @@ class IngameDialogueBox : public Singleton<IngameDialogueBox>, public GenericBox
 
             SDL_Texture* mTexture = nullptr;
             SDL_Point mSrcSize;
-            Map mSrcRectsMap;
+            std::array<Data_Glyph, 256> mGlyphs{};   // Indexed by `unsigned char`
 
             SDL_Texture* mTargetTexture = nullptr;
             SDL_Point mTargetTextureSize;
+            mutable SpriteBatch mBatch;   // Glyphs pending to be rendered to `mTargetTexture`
+
+            std::vector<Data_Placement> mLayout;   // One entry per char of the current line
+            mutable std::size_t mRevealedCount = 0;   // The number of chars of `mLayout` already queued
 
             ComponentPreset mPreset;
-            mutable SDL_Point mGlyphOrigin;
             SDL_Point mSpacing = { 0, 0 };
     };
 
@@ -364,7 +386,7 @@ class IngameDialogueBox : public Singleton<IngameDialogueBox>, public GenericBox
         static constexpr unsigned short int sDelayCounterLimit = config::components::dialogue_box::delayCounterLimit;
         unsigned short int mDelayCounter = sDelayCounterLimit;
 
-        TTF_Font* mFont = nullptr;
+        TTF_Font* mFont = nullptr;   // Acquired from `globals::fonts`
         static const std::filesystem::path sFontPath;
 
         Status mStatus = Status::kInactive;
@@ -1,8 +1,10 @@
 #ifndef ENTITIES_H
 #define ENTITIES_H
 
+#include <deque>
 #include <filesystem>
 #include <functional>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -19,6 +21,21 @@
 #include <auxiliaries.hpp>
 
 
+/**
+ * @brief Represent the per-frame budget shared by the spawn queues of all entity types.
+ * @note Recommended implementation: `reset()` should be called exactly once per frame, prior to any call to `AbstractEntity<T>::handleSpawnQueue()`.
+*/
+class SpawnBudget final {
+    public:
+        static void reset();
+        static bool consume();
+
+    private:
+        static unsigned int sCount;
+        static Uint64 sDeadline;
+};
+
+
 /* Abstract templates */
 
 /**
@@ -41,15 +58,24 @@ class AbstractEntity : public Multiton<T> {
         static void initialize();
         static void deinitialize();
         static void reinitialize(std::filesystem::path path);
+        static void release();
 
         /**
          * @brief Clear `instanceMapping` then call `onLevelChange()` method on every instance of derived class `T`.
+         * @note `sTilesetData` is loaded on demand, and released if unused by the current level.
          * @todo Allow only `level::EntityLevelData` and its subclasses. Try `<type_traits>` and `<concepts>`.
         */
-        static inline void onLevelChangeAll(std::vector<level::Data_Generic*> const& levelData) {
+        static inline void onLevelChangeAll(std::pmr::vector<level::Data_Generic*> const& levelData) {
             Multiton<T>::deinitialize();
+            sSpawnQueue.clear();
             sID_Counter = 0;
 
+            if (levelData.empty()) {
+                release();
+                return;
+            }
+            initialize();
+
             for (const auto data : levelData) {
                 if (data == nullptr) continue;
                 auto instance = instantiate(data->destCoords);
@@ -57,13 +83,31 @@ class AbstractEntity : public Multiton<T> {
             }
         }
 
-        static inline void instantiateEx(std::vector<level::Data_Generic*> const& levelData, bool reset = true) {
-            if (reset) level::data.erase(sTypeID);
-            for (const auto& data : levelData) level::data.insert(sTypeID, data);
-            onLevelChangeAll(level::data.get(sTypeID));
-            invoke(&T::onWindowChange);
+        /**
+         * @brief Register `levelData` to `level::data` and enqueue one spawn request per element. Instances are materialized by `handleSpawnQueue()` over the following frames, instead of all at once.
+         * @param reset if `true`, discard existing instances, pending spawn requests and level data of derived class `T` beforehand. Existing instances are otherwise left untouched.
+         * @param intervalTicks the delay between two consecutive spawn requests. Spawn requests preserve their relative timing regardless of the per-frame budget.
+        */
+        static inline void instantiateEx(std::pmr::vector<level::Data_Generic*> const& levelData, bool reset = true, unsigned int intervalTicks = 0) {
+            initialize();
+            if (reset) {
+                Multiton<T>::deinitialize();
+                sSpawnQueue.clear();
+                sID_Counter = 0;
+                level::data.erase(sTypeID);
+            }
+
+            unsigned int dueTicks = globals::frameClock.getTicks();
+            for (const auto& data : levelData) {
+                level::data.insert(sTypeID, data);
+                enqueueSpawn(data, dueTicks);
+                dueTicks += intervalTicks;
+            }
         }
 
+        static void handleSpawnQueue();
+        static inline bool hasPendingSpawns() { return !sSpawnQueue.empty(); }
+
         virtual void render() const;
         virtual void onWindowChange();
         virtual void onLevelChange(level::Data_Generic const& entityLevelData);
@@ -72,6 +116,7 @@ class AbstractEntity : public Multiton<T> {
         virtual void handleCustomEventGET(SDL_Event const& event) {}
 
         virtual bool isWithinRange(std::pair<int, int> const& x_coords_lim, std::pair<int, int> const& y_coords_lim) const;
+        inline SDL_Rect const& getDestRect() const { return mDestRect; }
 
     protected:
         AbstractEntity(SDL_Point const& destCoords);
@@ -83,7 +128,10 @@ class AbstractEntity : public Multiton<T> {
         const int mID;
 
         static std::filesystem::path sTilesetPath;
-        static tile::Data_EntityTileset sTilesetData;
+        /**
+         * Shared with `tile::cache`. Never `nullptr`.
+        */
+        static std::shared_ptr<const tile::Data_EntityTileset> sTilesetData;
 
         SDL_Point mDestCoords;
         SDL_Rect mSrcRect;
@@ -108,7 +156,19 @@ class AbstractEntity : public Multiton<T> {
         EntitySecondaryStats mSecondaryStats;
 
     private:
+        struct Data_SpawnRequest {
+            level::Data_Generic* data;
+            unsigned int dueTicks;
+        };
+
+        static void enqueueSpawn(level::Data_Generic* data, unsigned int dueTicks);
+
         static int sID_Counter;
+
+        /**
+         * Pending spawn requests, sorted by `dueTicks`. Elements point to data owned by `level::data`.
+        */
+        static std::deque<Data_SpawnRequest> sSpawnQueue;
 };
 
 namespace std {
@@ -123,8 +183,22 @@ namespace std {
     };
 };
 
-#define INCL_ABSTRACT_ENTITY(T) using AbstractEntity<T>::initialize, AbstractEntity<T>::deinitialize, AbstractEntity<T>::reinitialize, AbstractEntity<T>::onLevelChangeAll, AbstractEntity<T>::instantiateEx, AbstractEntity<T>::render, AbstractEntity<T>::onWindowChange, AbstractEntity<T>::onLevelChange, AbstractEntity<T>::handleCustomEventPOST, AbstractEntity<T>::handleCustomEventGET, AbstractEntity<T>::isWithinRange, AbstractEntity<T>::getDestRectFromCoords, AbstractEntity<T>::isTargetWithinRange, AbstractEntity<T>::mID, AbstractEntity<T>::sTilesetPath, AbstractEntity<T>::sTilesetData, AbstractEntity<T>::mDestCoords, AbstractEntity<T>::mSrcRect, AbstractEntity<T>::mDestRect, AbstractEntity<T>::mDestRectModifier, AbstractEntity<T>::mAngle, AbstractEntity<T>::mCenter, AbstractEntity<T>::mFlip, AbstractEntity<T>::mPrimaryStats, AbstractEntity<T>::mSecondaryStats;
+#define INCL_ABSTRACT_ENTITY(T) using AbstractEntity<T>::initialize, AbstractEntity<T>::deinitialize, AbstractEntity<T>::reinitialize, AbstractEntity<T>::release, AbstractEntity<T>::onLevelChangeAll, AbstractEntity<T>::instantiateEx, AbstractEntity<T>::handleSpawnQueue, AbstractEntity<T>::hasPendingSpawns, AbstractEntity<T>::render, AbstractEntity<T>::onWindowChange, AbstractEntity<T>::onLevelChange, AbstractEntity<T>::handleCustomEventPOST, AbstractEntity<T>::handleCustomEventGET, AbstractEntity<T>::isWithinRange, AbstractEntity<T>::getDestRect, AbstractEntity<T>::getDestRectFromCoords, AbstractEntity<T>::isTargetWithinRange, AbstractEntity<T>::mID, AbstractEntity<T>::sTilesetPath, AbstractEntity<T>::sTilesetData, AbstractEntity<T>::mDestCoords, AbstractEntity<T>::mSrcRect, AbstractEntity<T>::mDestRect, AbstractEntity<T>::mDestRectModifier, AbstractEntity<T>::mAngle, AbstractEntity<T>::mCenter, AbstractEntity<T>::mFlip, AbstractEntity<T>::mPrimaryStats, AbstractEntity<T>::mSecondaryStats;
+
+
+/**
+ * @brief Opt-in for entities whose instances all loop their idle animation in lockstep e.g. decorations. Specialize as `true` to enable.
+ * @see AbstractAnimatedEntity<T>::updateAnimationAll()
+*/
+template <typename T>
+inline constexpr bool kIsAmbient = false;
 
+/**
+ * @brief The layer instances are submitted to `globals::renderQueue` under. Specialize to draw a type above or below others regardless of depth.
+ * @see AbstractEntity<T>::render()
+*/
+template <typename T>
+inline constexpr unsigned int kRenderLayer = config::entities::layer::standard;
 
 /**
  * @brief An abstract class combining CRTP and adapted Multiton pattern. Represents an entity that updates animation.
@@ -140,14 +214,15 @@ class AbstractAnimatedEntity : public AbstractEntity<T> {
         static void reinitialize(std::filesystem::path path);
 
         void onLevelChange(level::Data_Generic const& entityLevelData) override;
-        virtual void handleSFX() const;
 
+        static void updateAnimationAll();
         virtual void updateAnimation();
         void resetAnimation(Animation animation, BehaviouralType flag = BehaviouralType::kDefault);
 
-        inline bool isAnimationAtSprite(int GID) const { return mAnimationGID == GID; }
-        inline bool isAnimationAtFirstSprite() const { return isAnimationAtSprite(mAnimationData.startGID); }
-        inline bool isAnimationAtFinalSprite() const { return isAnimationAtSprite(mAnimationData.stopGID); }
+        inline unsigned int getAnimationFrame() const { return mAnimationFrame; }
+        inline bool isAnimationAtSprite(unsigned int index) const { return mAnimationFrame == index; }
+        inline bool isAnimationAtFirstSprite() const { return isAnimationAtSprite(0); }
+        inline bool isAnimationAtFinalSprite() const { return mAnimationData.frameCount && isAnimationAtSprite(mAnimationData.frameCount - 1); }
 
     protected:
         AbstractAnimatedEntity(SDL_Point const& destCoords);
@@ -159,12 +234,14 @@ class AbstractAnimatedEntity : public AbstractEntity<T> {
         SDL_Point mAttackRegisterRange;
 
     private:
+        void updateAnimationFrame(bool isEntered);
+
         tile::Data_EntityTileset::Data_Animation mAnimationData;
         CountdownTimer mAnimationTimer;
-        int mAnimationGID;
+        unsigned int mAnimationFrame = 0;   // Index into `mAnimationData`
 };
 
-#define INCL_ABSTRACT_ANIMATED_ENTITY(T) using AbstractAnimatedEntity<T>::reinitialize, AbstractAnimatedEntity<T>::onLevelChange, AbstractAnimatedEntity<T>::handleSFX, AbstractAnimatedEntity<T>::updateAnimation, AbstractAnimatedEntity<T>::resetAnimation, AbstractAnimatedEntity<T>::isAnimationAtSprite, AbstractAnimatedEntity<T>::isAnimationAtFirstSprite, AbstractAnimatedEntity<T>::isAnimationAtFinalSprite, AbstractAnimatedEntity<T>::mBaseAnimation, AbstractAnimatedEntity<T>::mAnimation, AbstractAnimatedEntity<T>::mDirection, AbstractAnimatedEntity<T>::mAttackRegisterRange;
+#define INCL_ABSTRACT_ANIMATED_ENTITY(T) using AbstractAnimatedEntity<T>::reinitialize, AbstractAnimatedEntity<T>::onLevelChange, AbstractAnimatedEntity<T>::updateAnimationAll, AbstractAnimatedEntity<T>::updateAnimation, AbstractAnimatedEntity<T>::resetAnimation, AbstractAnimatedEntity<T>::getAnimationFrame, AbstractAnimatedEntity<T>::isAnimationAtSprite, AbstractAnimatedEntity<T>::isAnimationAtFirstSprite, AbstractAnimatedEntity<T>::isAnimationAtFinalSprite, AbstractAnimatedEntity<T>::mBaseAnimation, AbstractAnimatedEntity<T>::mAnimation, AbstractAnimatedEntity<T>::mDirection, AbstractAnimatedEntity<T>::mAttackRegisterRange;
 
 /**
  * @brief A shorthand to declare a AAE-derived. Used in header files only.
@@ -403,7 +480,7 @@ class GenericHostileEntity : public AbstractAnimatedDynamicEntity<T> {
         void handleCustomEventGET(SDL_Event const& event) override;
 
         static inline unsigned int getDeathCount() { return sDeathCount; }
-        static inline bool isAllDead() { return sDeathCount == static_cast<unsigned int>(instances.size()); }
+        static inline bool isAllDead() { return sDeathCount == static_cast<unsigned int>(instances.size()) && !hasPendingSpawns(); }
 
     protected:
         GenericHostileEntity(SDL_Point const& destCoords);
@@ -589,6 +666,7 @@ class Player final : public Singleton<Player>, public AbstractAnimatedDynamicEnt
         Player(SDL_Point const& destCoords);
         ~Player() = default;
 
+        static void initialize();
         static void deinitialize();
         static void reinitialize(bool increment);
 
@@ -599,8 +677,6 @@ class Player final : public Singleton<Player>, public AbstractAnimatedDynamicEnt
         void handleCustomEventPOST() const override;
         void handleCustomEventGET(SDL_Event const& event) override;
 
-        void handleSFX() const override;
-
     private:
         void handleKeyboardEvent_Movement(SDL_Event const& event);
         void handleKeyboardEvent_ProjectileAttack(SDL_Event const& event);
@@ -633,7 +709,10 @@ class Player final : public Singleton<Player>, public AbstractAnimatedDynamicEnt
         typename std::enable_if_t<C == event::Code::kResp_Teleport_GTE_Player>
         handleCustomEventGET_impl(SDL_Event const& event);
 
+        static void prefetchAdjacentTilesets();
+
         static const std::vector<std::filesystem::path> sTilesetPaths;
+        static unsigned short int sTilesetPathIndex;
 };
 
 
@@ -662,4 +741,23 @@ DECL_GENERIC_HOSTILE_ENTITY(Slime)
 DECL_GENERIC_SURGE_PROJECTILE(PentacleProjectile)
 
 
+/* Ambient entities */
+
+template <> inline constexpr bool kIsAmbient<OmoriLightBulb> = true;
+template <> inline constexpr bool kIsAmbient<OmoriKeysWASD> = true;
+template <> inline constexpr bool kIsAmbient<OmoriCat_0> = true;
+template <> inline constexpr bool kIsAmbient<OmoriCat_1> = true;
+template <> inline constexpr bool kIsAmbient<OmoriCat_2> = true;
+template <> inline constexpr bool kIsAmbient<OmoriCat_3> = true;
+template <> inline constexpr bool kIsAmbient<OmoriCat_4> = true;
+template <> inline constexpr bool kIsAmbient<OmoriCat_5> = true;
+template <> inline constexpr bool kIsAmbient<OmoriCat_6> = true;
+template <> inline constexpr bool kIsAmbient<OmoriCat_7> = true;
+
+
+/* Render layers */
+
+template <> inline constexpr unsigned int kRenderLayer<PentacleProjectile> = config::entities::layer::projectile;
+
+
 #endif
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef FONT_REGISTRY_H
+#define FONT_REGISTRY_H
+
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include <glyph-atlas.hpp>
+
+
+/**
+ * @brief Hand out `TTF_Font` handles shared process-wide, keyed by (path, point size) and reference-counted.
+ * @note Each font file is read into memory once, upon its first request, then retained until `clear()`. Fonts of any size are opened from that copy, hence resizing never touches the disk again.
+ * @note Each handle comes with a `GlyphAtlas`, hence every user of the same (path, point size) shares rasterized glyphs too.
+*/
+class FontRegistry final {
+    struct Data_Font {
+        TTF_Font* font = nullptr;
+        GlyphAtlas glyphAtlas;
+        std::size_t refCount = 0;
+    };
+
+    using Key = std::pair<std::string, int>;
+
+    public:
+        FontRegistry() = default;
+        ~FontRegistry() = default;
+
+        FontRegistry(FontRegistry const&) = delete;
+        FontRegistry& operator=(FontRegistry const&) = delete;
+
+        TTF_Font* acquire(std::filesystem::path const& path, int size);
+        void release(TTF_Font* font);
+        void clear();
+
+        GlyphAtlas* getGlyphAtlas(TTF_Font* font);
+
+    private:
+        std::vector<char> const* loadFile(std::string const& path);
+
+        std::map<Key, Data_Font> mFonts;   // Node-based, hence entries never move
+        std::unordered_map<TTF_Font*, std::map<Key, Data_Font>::iterator> mHandles;
+        std::unordered_map<std::string, std::vector<char>> mFiles;   // Must outlive every font opened from them
+};
+
+
+#endif
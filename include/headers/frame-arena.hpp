@@ -0,0 +1,75 @@
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+
+/**
+ * @brief A linear i.e. bump allocator for data that lives for at most one frame. Usable with `std::pmr` containers.
+ * @note Deallocation is a no-op: memory is reclaimed all at once via `reset()`. Requests exceeding the capacity are forwarded to `upstream` and released on `reset()` as well.
+ * @note Destructors are never called on reclaimed memory, hence only trivially destructible data should be placed here directly.
+*/
+class FrameArena final : public std::pmr::memory_resource {
+    struct Data_Overflow {
+        void* ptr;
+        std::size_t bytes;
+        std::size_t alignment;
+    };
+
+    public:
+        inline FrameArena(std::size_t capacity, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) : mBuffer(new std::byte[capacity]), mCapacity(capacity), mUpstream(upstream) {}
+        inline ~FrameArena() { reset(); }
+
+        /**
+         * @brief Reclaim every allocation made since the previous call.
+         * @note Recommended implementation: this method should be called once, at the very end of every frame.
+        */
+        inline void reset() {
+            mHighWaterMark = std::max(mHighWaterMark, getSize());
+            for (auto const& overflow : mOverflows) mUpstream->deallocate(overflow.ptr, overflow.bytes, overflow.alignment);
+            mOverflows.clear();
+            mOffset = mOverflowSize = 0;
+        }
+
+        inline std::size_t getCapacity() const { return mCapacity; }
+        inline std::size_t getSize() const { return mOffset + mOverflowSize; }
+        inline std::size_t getHighWaterMark() const { return std::max(mHighWaterMark, getSize()); }
+        inline std::size_t getOverflowCount() const { return mOverflows.size(); }
+
+    private:
+        inline void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            void* ptr = mBuffer.get() + mOffset;
+            std::size_t space = mCapacity - mOffset;
+
+            if (std::align(alignment, bytes, ptr, space) != nullptr) {
+                mOffset = mCapacity - space + bytes;
+                return ptr;
+            }
+
+            // Exceeded capacity, fall back to `mUpstream`
+            ptr = mUpstream->allocate(bytes, alignment);
+            mOverflows.push_back({ ptr, bytes, alignment });
+            mOverflowSize += bytes;
+            return ptr;
+        }
+
+        inline void do_deallocate(void*, std::size_t, std::size_t) override {}
+        inline bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override { return this == &other; }
+
+        std::unique_ptr<std::byte[]> mBuffer;
+        std::size_t mCapacity;
+        std::size_t mOffset = 0;
+
+        std::pmr::memory_resource* mUpstream;
+        std::vector<Data_Overflow> mOverflows;
+        std::size_t mOverflowSize = 0;
+
+        std::size_t mHighWaterMark = 0;
+};
+
+
+#endif
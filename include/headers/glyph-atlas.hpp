@@ -0,0 +1,71 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include <sprite-batch.hpp>
+
+
+/**
+ * @brief Rasterize the glyphs of a `TTF_Font` on demand, once each, into shared texture pages, then draw text as one textured quad per glyph.
+ * @note Glyphs are rasterized in white, hence any text color is applied per quad. Strings are laid out once, then retained in a bounded cache, hence redrawing or switching between recently used strings costs neither rasterization nor texture creation.
+ * @note Recommended implementation: `clear()` should be called prior to closing the font or destroying the renderer, since textures are not released upon destruction.
+*/
+class GlyphAtlas final {
+    public:
+        /**
+         * @param texture the page `srcRect` belongs to. `nullptr` for glyphs without visible pixels e.g. whitespace.
+         * @param offset the position of `srcRect` relative to the pen position.
+        */
+        struct Data_Glyph {
+            SDL_Texture* texture = nullptr;
+            SDL_Rect srcRect{};
+            SDL_Point offset{};
+            int advance = 0;
+        };
+
+        /**
+         * @param quads positioned relative to the top-left corner of the text.
+         * @param size the extent of the text, as would be reported by `TTF_SizeUTF8()`.
+        */
+        struct Data_Layout {
+            std::vector<SpriteBatch::Data_Quad> quads;
+            SDL_Point size{};
+        };
+
+        GlyphAtlas() = default;
+        ~GlyphAtlas() = default;
+
+        GlyphAtlas(GlyphAtlas const&) = delete;
+        GlyphAtlas& operator=(GlyphAtlas const&) = delete;
+
+        void load(TTF_Font* font);
+        void clear();
+
+        Data_Layout const& layout(std::string const& text);
+        void render(SpriteBatch& batch, std::string const& text, SDL_Point const& destCoords, SDL_Color const& color, int layer = 0);
+
+        inline TTF_Font* getFont() const { return mFont; }
+
+    private:
+        Data_Glyph const& getGlyph(Uint32 codepoint);
+        Data_Glyph rasterize(Uint32 codepoint);
+        SDL_Texture* allocate(SDL_Point const& size, SDL_Rect& srcRect);
+
+        TTF_Font* mFont = nullptr;
+
+        std::vector<SDL_Texture*> mPages;
+        SDL_Point mShelfOrigin{};   // Within the last page
+        int mShelfHeight = 0;
+
+        std::unordered_map<Uint32, Data_Glyph> mGlyphs;   // Keyed by Unicode codepoint
+        std::unordered_map<std::string, Data_Layout> mLayouts;
+};
+
+
+#endif
@@ -1,7 +1,11 @@
 #ifndef INTERFACE_H
 #define INTERFACE_H
 
+#include <bitset>
+#include <cstddef>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include <SDL.h>
 
@@ -58,14 +62,64 @@ class IngameMapHandler final : public AbstractInterface<IngameMapHandler> {
         inline level::Name getLevel() { return mLevelName; }
         void changeLevel(const level::Name levelName);
 
+        void setTile(SDL_Point const& tileCoords, std::size_t layer, tile::GID gid);
+        void invalidate(SDL_Rect const& tileRect) const;
+
         bool isOnGrayscale = false;
 
     private:
+        /**
+         * @brief A square of `config::interface::mapChunkTileCount` tiles per dimension, baked into its own texture.
+         * @param destRect the position and size of the chunk, in level coordinates. Chunks on the right and bottom edges might be smaller.
+         * @param textureMemory the estimated size of both textures, in bytes.
+         * @param lastAccess the value of `mAccessCounter` upon the latest frame the chunk was visible or prefetched.
+         * @param dirtyTiles tiles of `texture` to be re-composited before the chunk is next drawn, in row-major order relative to the chunk.
+        */
+        struct Data_Chunk {
+            using TileMask = std::bitset<config::interface::mapChunkTileCount * config::interface::mapChunkTileCount>;
+
+            SDL_Texture* texture = nullptr;
+            SDL_Texture* grayscaleTexture = nullptr;   // A grayscaled version of `texture`, baked on demand
+            SDL_Rect destRect;
+            std::size_t textureMemory = 0;
+            unsigned long long int lastAccess = 0;
+
+            TileMask dirtyTiles;
+            TileMask grayscaleDirtyTiles;
+        };
+
+        /**
+         * @brief Contain every occurrence of an animated GID within the level.
+         * @param tileCoords unique i.e. a tile holding the GID on several layers occurs once.
+         * @param currGID the frame currently baked into chunks.
+        */
+        struct Data_AnimatedTile {
+            tile::Data_TileAnimation const* animation = nullptr;
+            tile::GID currGID = 0;
+            std::vector<SDL_Point> tileCoords;
+        };
+
         void loadLevel() const;
 
-        void renderToTexture();
-        void renderBackground() const;
-        void renderLevelTilelayers() const;
+        Data_Chunk& getChunk(SDL_Point const& chunkCoords) const;
+        void bakeChunk(Data_Chunk& chunk) const;
+        void bakeGrayscaleChunk(Data_Chunk& chunk) const;
+        void recompositeChunk(Data_Chunk& chunk, bool isGrayscale) const;
+        void releaseGrayscaleChunk(Data_Chunk& chunk) const;
+        SDL_Rect getTileRect(Data_Chunk const& chunk) const;
+
+        void loadAnimatedTiles();
+        void registerAnimatedTile(tile::GID gid, SDL_Point const& tileCoords);
+        void unregisterAnimatedTile(tile::GID gid, SDL_Point const& tileCoords);
+        void updateAnimatedTiles() const;
+        tile::GID resolveAnimatedTile(tile::GID gid) const;
+
+        static unsigned int getGrayscaleIntensity();
+        void trimChunks(std::size_t budget) const;
+        void clearChunks() const;
+
+        void renderBackground(SDL_Color const& color) const;
+        void renderChunkTilelayers(Data_Chunk const& chunk, bool isGrayscale = false, Data_Chunk::TileMask const* mask = nullptr) const;
 
         level::Name mLevelName;
 
@@ -75,10 +129,13 @@ class IngameMapHandler final : public AbstractInterface<IngameMapHandler> {
         */
         static level::Map sLevelMap;
 
-        /**
-         * A grayscaled version of `texture`.
-        */
-        SDL_Texture* mGrayscaleTexture = nullptr;
+        mutable std::unordered_map<int, Data_Chunk> mChunks;   // Keyed by the index of the chunk in row-major order
+        SDL_Point mChunkCount{};
+        SDL_Point mChunkSize{};   // In level coordinates
+        mutable std::size_t mChunkMemory = 0;
+        mutable unsigned long long int mAccessCounter = 0;
+
+        mutable std::unordered_map<tile::GID, Data_AnimatedTile> mAnimatedTiles;   // Keyed by the GID stored in `level::data.tiles`
 };
 
 
@@ -105,6 +162,8 @@ class IngameViewHandler final : public AbstractInterface<IngameViewHandler> {
         void switchView();
 
     private:
+        void calculateViewport() const;
+
         friend class IngameInterface;   // Provide access to private member `mTileCountWidth` and `mTileCountHeight`
 
         /**
@@ -153,7 +212,8 @@ class IngameInterface final : public Singleton<IngameInterface> {
     private:
         void handleEntitiesInteraction() const;
         void handleLevelSpecifics() const;
-        void handleEntitiesSFX() const;
+        void handleEntitiesAnimationEvents() const;
+        void handleEntitiesSpawn() const;
 
         template <event::Code C>
         typename std::enable_if_t<C == event::Code::kResp_Teleport_GTE_Player>
@@ -0,0 +1,91 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/**
+ * @brief A work-stealing thread pool. Each thread i.e. the main thread and every worker owns a queue; owners pop from the back, idle threads steal from the front of others' queues.
+ * @note Threads waiting on a batch help execute pending jobs instead of blocking, hence `parallelFor()` might be nested.
+ * @note Jobs must not call into SDL, nor touch data owned by the main thread e.g. `globals::arena`. SDL calls stay on the main thread.
+ * @note Until `initialize()` is called, or with zero workers, every batch runs inline on the calling thread.
+*/
+class JobSystem final {
+    /**
+     * @param counter the number of unfinished jobs of the batch the job belongs to.
+    */
+    struct Data_Job {
+        std::function<void()> task;
+        std::atomic<std::size_t>* counter = nullptr;
+    };
+
+    struct Data_Queue {
+        std::mutex mutex;
+        std::deque<Data_Job> jobs;
+    };
+
+    public:
+        JobSystem() = default;
+        ~JobSystem() { terminate(); }
+
+        JobSystem(JobSystem const&) = delete;
+        JobSystem& operator=(JobSystem const&) = delete;
+
+        void initialize(std::size_t workerCount);
+        void terminate();
+
+        /**
+         * @brief Call `callable(begin, end)` over consecutive subranges of `[0, count)`, then wait for every subrange to finish.
+         * @param grain the maximum size of a subrange. Batches no larger than `grain` run inline.
+         * @note The first subrange runs on the calling thread.
+        */
+        template <typename Callable>
+        void parallelFor(std::size_t count, Callable&& callable, std::size_t grain = 0) {
+            if (!count) return;
+            if (!grain) grain = std::max<std::size_t>(kMinGrain, count / (mQueueCount * kChunksPerThread) + 1);
+            if (mWorkers.empty() || count <= grain) { callable(std::size_t(0), count); return; }
+
+            std::atomic<std::size_t> counter((count - 1) / grain);
+            for (auto begin = grain; begin < count; begin += grain) {
+                auto end = std::min(begin + grain, count);
+                submit({ [&callable, begin, end]() { callable(begin, end); }, &counter });
+            }
+
+            callable(std::size_t(0), grain);
+            wait(counter);
+        }
+
+        inline std::size_t getWorkerCount() const { return mWorkers.size(); }
+
+    private:
+        static constexpr std::size_t kMinGrain = 16;
+        static constexpr std::size_t kChunksPerThread = 4;   // Finer chunks balance better at the cost of more queue traffic
+
+        void submit(Data_Job&& job);
+        void wait(std::atomic<std::size_t>& counter);
+        bool execute();
+        void run(std::size_t index);
+
+        std::vector<std::thread> mWorkers;
+        std::unique_ptr<Data_Queue[]> mQueues;   // Index `0` belongs to the thread that called `initialize()`
+        std::size_t mQueueCount = 1;
+
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        std::atomic<std::size_t> mPendingCount = 0;
+        std::atomic<bool> mIsTerminated = false;
+
+        static thread_local std::size_t sQueueIndex;
+};
+
+
+#endif
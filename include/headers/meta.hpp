@@ -2,6 +2,7 @@
 #define META_H
 
 #include <functional>
+#include <memory_resource>
 #include <unordered_set>
 #include <type_traits>
 
@@ -12,9 +13,11 @@
 
 
 /**
- * @brief An abstract base with certain operators deleted. Required for implementation of derived classes `Singleton<T>` and `Multiton<T>`.
+ * @brief An empty, non-copyable and non-movable base. Required for implementation of derived classes `Singleton<T>` and `Multiton<T>`.
+ * @note Parameterized by the derived meta-pattern (i.e. `Singleton<T>` or `Multiton<T>`) instead of `T` itself, so that a class inheriting both never holds two identical base subobjects. This allows non-virtual inheritance and keeps the empty base optimization intact.
+ * @note Deliberately not polymorphic: instances are always destroyed via a pointer to the most derived type `T`.
 */
-template <typename T>
+template <typename Derived>
 class PolymorphicBase {
     public:
         PolymorphicBase(PolymorphicBase const&) = delete;
@@ -24,7 +27,7 @@ class PolymorphicBase {
 
     protected:
         explicit PolymorphicBase() = default;
-        virtual ~PolymorphicBase() = default;
+        ~PolymorphicBase() = default;
 };
 
 
@@ -32,7 +35,7 @@ class PolymorphicBase {
  * @brief A standard Singleton template class.
 */
 template <typename T>
-class Singleton : virtual public PolymorphicBase<T> {
+class Singleton : public PolymorphicBase<Singleton<T>> {
     public:
         template <typename... Args>
         static T* instantiate(Args&&... args) {
@@ -79,8 +82,8 @@ class Singleton : virtual public PolymorphicBase<T> {
  * @brief An adapted Multiton template class that governs instances via a `std::unordered_set` instead of a `std::unordered_map`.
 */
 template <typename T>
-class Multiton : virtual public PolymorphicBase<T> {
-    public:      
+class Multiton : public PolymorphicBase<Multiton<T>> {
+    public:
         template <typename... Args>
         static T* instantiate(Args&&... args) {
             auto instance = new T(std::forward<Args>(args)...);
@@ -101,8 +104,7 @@ class Multiton : virtual public PolymorphicBase<T> {
         }
 
         /**
-         * @bug Somehow this yields weird segmentation faults. Might consider switching to smart pointers.
-         * @note Segmentation faults are, weirdly, unencountered as of this commit. Perhaps due to the transitioning to `dynamic_cast`?
+         * @note Instances are handed over to `globals::gc` instead of being deleted immediately, since they might still be referenced during the current frame.
         */
         static void deinitialize() {
             // Somehow this yields weird segfaults. Consider switching to smart pointers?
@@ -111,6 +113,14 @@ class Multiton : virtual public PolymorphicBase<T> {
             instances.clear();
         }
 
+        /**
+         * @brief Remove `instance` from `instances` and hand it over to `globals::gc`.
+         * @note Instances not governed by `instances` (e.g. already deinitialized) are ignored, hence despawning the same instance twice is harmless.
+        */
+        static void despawn(T* instance) {
+            if (instances.erase(instance)) globals::gc.insert(instance);
+        }
+
         /**
          * @brief Variadically call `method` on each instance of derived class `T` with the same parameters `args`.
          * @note Defined here to avoid lengthy explicit template instantiation.
@@ -121,14 +131,27 @@ class Multiton : virtual public PolymorphicBase<T> {
             for (auto& instance : instances) if (instance != nullptr) std::invoke(std::forward<Callable>(callable), *instance, std::forward<Args>(args)...);
         }
 
+        /**
+         * @brief Similar to `invoke()`, but instances are distributed across `globals::jobs`.
+         * @note `callable` must only mutate the instance it is called on, and must not call into SDL. Structural changes should be recorded into `globals::commands` instead.
+         * @note Recommended implementation: this method should be called from the main thread only, since the snapshot of `instances` is allocated from `globals::arena`.
+        */
+        template <typename Callable, typename... Args>
+        static void invokeParallel(Callable&& callable, Args const&... args) {
+            if (instances.empty()) return;
+
+            std::pmr::vector<T*> snapshot(instances.begin(), instances.end(), &globals::arena);
+            globals::jobs.parallelFor(snapshot.size(), [&](std::size_t begin, std::size_t end) {
+                for (auto index = begin; index < end; ++index) if (snapshot[index] != nullptr) std::invoke(callable, *snapshot[index], args...);
+            });
+        }
+
     protected:
         /**
-         * @see https://stackoverflow.com/questions/3747066/c-cannot-convert-from-base-a-to-derived-type-b-via-virtual-base-a
-         * @remark You can't use `static_cast` in this situation because the compiler doesn't know the offset of B relative to A at compile time. The offset must be calculated at run-time based on the exact type of the most derived object. Therefore you must use `dynamic_cast`.
-         * @note Compile-time `static_cast` yields "error: cannot convert from pointer to base class `Multiton<T>` to pointer to derived class `T` because the base is virtual". Therefore run-time `dynamic_cast` must be used instead.
+         * @note Since `Multiton<T>` is a non-virtual base of `T`, the offset of `T` relative to `Multiton<T>` is known at compile time, hence `static_cast` suffices.
         */
-        virtual ~Multiton() {
-            instances.erase(reinterpret_cast<T*>(this));   // remove from `instances`
+        ~Multiton() {
+            instances.erase(static_cast<T*>(this));   // remove from `instances`
         }
 
         static std::unordered_set<T*> instances;
@@ -140,7 +163,7 @@ class Multiton : virtual public PolymorphicBase<T> {
         }
 };
 
-#define INCL_MULTITON(T) using Multiton<T>::instantiate, Multiton<T>::deinitialize, Multiton<T>::invoke, Multiton<T>::instances;
+#define INCL_MULTITON(T) using Multiton<T>::instantiate, Multiton<T>::deinitialize, Multiton<T>::despawn, Multiton<T>::invoke, Multiton<T>::invokeParallel, Multiton<T>::instances;
 
 
 /* Internal initialization of static members */
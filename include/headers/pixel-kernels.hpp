@@ -0,0 +1,64 @@
+#ifndef PIXEL_KERNELS_H
+#define PIXEL_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SDL.h>
+
+
+/**
+ * @brief Per-pixel effects over raw `SDL_PIXELFORMAT_RGBA32` pixels, in integer arithmetic.
+ * @note Each kernel has a scalar implementation, plus SSE2, AVX2 and NEON ones. The fastest one supported by the CPU is selected once, at startup. Every implementation yields bit-identical results.
+ * @note Kernels are stateless, hence might be called from any thread.
+*/
+namespace pixel {
+    /**
+     * @brief The instruction set the kernels were selected for.
+    */
+    enum class Backend {
+        kScalar,
+        kSSE2,
+        kAVX2,
+        kNEON,
+    };
+
+    /**
+     * @brief Blend each pixel towards its luma by `intensity`. Alpha is left untouched.
+     * @param intensity in `[0, 256]`, where `256` yields pure grayscale.
+    */
+    void grayscale(std::uint32_t* pixels, std::size_t count, unsigned int intensity);
+
+    /**
+     * @brief Multiply each channel by the matching channel of `color` i.e. the equivalent of texture color and alpha modulation.
+    */
+    void tint(std::uint32_t* pixels, std::size_t count, SDL_Color const& color);
+
+    /**
+     * @brief Multiply the color channels of each pixel by its alpha.
+    */
+    void premultiplyAlpha(std::uint32_t* pixels, std::size_t count);
+
+    /**
+     * @brief Clear the alpha of each pixel whose color channels match those of `key`.
+    */
+    void colorKey(std::uint32_t* pixels, std::size_t count, SDL_Color const& key);
+
+    SDL_Color grayscale(SDL_Color const& color, unsigned int intensity);
+
+    bool grayscale(SDL_Surface* surface, unsigned int intensity);
+    bool tint(SDL_Surface* surface, SDL_Color const& color);
+    bool premultiplyAlpha(SDL_Surface* surface);
+    bool colorKey(SDL_Surface* surface, SDL_Color const& key);
+
+    Backend getBackend();
+    const char* getBackendName(Backend backend);
+    inline const char* getBackendName() { return getBackendName(getBackend()); }
+
+    std::vector<Backend> getSupportedBackends();
+    bool setBackend(Backend backend);
+}
+
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef RENDER_COMMAND_BUFFER_H
+#define RENDER_COMMAND_BUFFER_H
+
+#include <cstddef>
+#include <vector>
+
+#include <SDL.h>
+
+
+/**
+ * @brief Record render state changes and draw calls, then replay them against an `SDL_Renderer` in one go, skipping those that would not change anything.
+ * @note Render target and draw color changes are deferred until a draw call actually depends on them, hence consecutive changes collapse into one, and a target restored then immediately switched away from is never bound at all. Texture modulations and blend modes are skipped if equal to the current ones.
+ * @note Recommended implementation: pending commands must be submitted prior to any direct SDL call that reads or depends on the render state e.g. `SDL_RenderReadPixels()`. `SpriteBatch::flush()` does so on its own.
+ * @note Textures referenced by pending commands must outlive the next `submit()` call.
+ * @note Texture modulations and blend modes first flush `globals::batch` if it has pending quads sampling the same texture, since those were queued under the previous state.
+*/
+class RenderCommandBuffer final {
+    struct Data_Command {
+        enum class Type {
+            kSetRenderTarget,
+            kSetRenderDrawColor,
+            kSetTextureAlphaMod,
+            kSetTextureColorMod,
+            kSetTextureBlendMode,
+            kRenderClear,
+            kRenderFillRect,
+            kRenderCopy,
+        };
+
+        Type type;
+        SDL_Texture* texture = nullptr;
+        SDL_Color color{};
+        SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+        SDL_Rect srcRect{};
+        SDL_Rect destRect{};
+        bool hasSrcRect = false;
+        bool hasDestRect = false;
+    };
+
+    public:
+        /**
+         * @brief Commands submitted by every instance, per frame.
+         * @param elidedStateChangeCount state changes recorded but never forwarded to SDL, since redundant.
+         * @param targetSwitchCount actual `SDL_SetRenderTarget()` calls.
+        */
+        struct Data_Stats {
+            std::size_t commandCount = 0;
+            std::size_t elidedStateChangeCount = 0;
+            std::size_t targetSwitchCount = 0;
+        };
+
+        RenderCommandBuffer() = default;
+        ~RenderCommandBuffer() = default;
+
+        RenderCommandBuffer(RenderCommandBuffer const&) = delete;
+        RenderCommandBuffer& operator=(RenderCommandBuffer const&) = delete;
+
+        void setRenderTarget(SDL_Texture* texture);
+        void setRenderDrawColor(SDL_Color const& color);
+        void setTextureAlphaMod(SDL_Texture* texture, Uint8 alpha);
+        void setTextureColorMod(SDL_Texture* texture, SDL_Color const& color);
+        void setTextureBlendMode(SDL_Texture* texture, SDL_BlendMode blendMode);
+
+        void renderClear();
+        void renderFillRect(SDL_Rect const* destRect = nullptr);
+        void renderCopy(SDL_Texture* texture, SDL_Rect const* srcRect = nullptr, SDL_Rect const* destRect = nullptr);
+
+        void submit(SDL_Renderer* renderer);
+
+        /**
+         * @return The render target as of the latest recorded command i.e. the one subsequent commands are recorded against.
+        */
+        inline SDL_Texture* getRenderTarget() const { return mRenderTarget; }
+        inline bool empty() const { return mCommands.empty(); }
+
+        static void endFrame();
+        inline static Data_Stats const& getStats() { return sPrevStats; }
+
+    private:
+        static void flushBatch(SDL_Texture* texture);
+
+        std::vector<Data_Command> mCommands;   // Emptied rather than released on submit, to reuse capacity
+        SDL_Texture* mRenderTarget = nullptr;   // `nullptr` represents the window
+
+        static Data_Stats sStats;
+        static Data_Stats sPrevStats;   // Stats of the latest complete frame
+};
+
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL.h>
+
+#include <sprite-batch.hpp>
+
+
+/**
+ * @brief Collect sprites under a 32-bit sort key composed of, from the most significant bits: `layer`, `depth` i.e. the bottom edge of the sprite, then the texture. Sprites are sorted once per frame, then forwarded to a `SpriteBatch` in order.
+ * @note Sorting is a stable least-significant-digit radix sort, hence linear in the number of sprites. Sprites with identical keys retain their submission order.
+ * @note Keying by texture last groups sprites of equal depth by texture, which lengthens the runs `SpriteBatch` merges into single draw calls.
+*/
+class RenderQueue final {
+    using Key = std::uint32_t;
+
+    struct Data_Entry {
+        Key key;
+        std::uint32_t index;   // Into `mQuads`
+    };
+
+    public:
+        RenderQueue() = default;
+        ~RenderQueue() = default;
+
+        RenderQueue(RenderQueue const&) = delete;
+        RenderQueue& operator=(RenderQueue const&) = delete;
+
+        void submit(SpriteBatch::Data_Quad const& quad, unsigned int layer, int depth);
+        void flush(SpriteBatch& batch, int batchLayer = 0);
+        void clear();
+
+        inline std::size_t size() const { return mQuads.size(); }
+
+    private:
+        static constexpr unsigned int kLayerBits = 4;
+        static constexpr unsigned int kDepthBits = 16;
+        static constexpr unsigned int kTextureBits = 32 - kLayerBits - kDepthBits;
+        static constexpr unsigned int kDigitBits = 8;
+        static constexpr std::size_t kRadix = 1 << kDigitBits;
+        static constexpr unsigned int kPassCount = 32 / kDigitBits;
+
+        Key getTextureKey(SDL_Texture* texture);
+        void sort();
+
+        std::vector<SpriteBatch::Data_Quad> mQuads;
+        std::vector<Data_Entry> mEntries;
+        std::vector<Data_Entry> mScratch;   // Ping-pong buffer for `sort()`
+
+        std::unordered_map<SDL_Texture*, Key> mTextureKeys;   // Assigned in order of first submission, per frame
+};
+
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include <SDL.h>
+
+
+/**
+ * @brief Collect textured quads per layer, then submit runs of consecutive quads sharing a texture as a single draw call.
+ * @note Layers are flushed in ascending order. Within a layer, quads retain their submission order, hence overlapping quads are drawn exactly as if they were rendered one by one.
+ * @note Flips are expressed as swapped texture coordinates, rotations as rotated corners. Texture color and alpha modulation are baked into vertex colors, along with the color of each quad.
+ * @note Requires SDL 2.0.18 for `SDL_RenderGeometry()`. Older versions, or renderers rejecting geometry, fall back to one `SDL_RenderCopyEx()` per quad.
+ * @note Recommended implementation: pending quads must be flushed prior to changing the render target, or prior to any unbatched draw call that should appear on top of them. Draw calls recorded into `globals::renderCommands` count as unbatched.
+*/
+class SpriteBatch final {
+    public:
+        /**
+         * @brief The arguments of an equivalent `SDL_RenderCopyEx()` call.
+         * @param angle in degrees, clockwise, around `center`.
+         * @param center relative to `destRect`. Only considered if `hasCenter` is set, otherwise the center of `destRect` is used.
+         * @param color modulates the texture on top of its own color and alpha modulation, hence quads sharing a texture may differ in color yet still be merged.
+        */
+        struct Data_Quad {
+            SDL_Texture* texture = nullptr;
+            SDL_Rect srcRect;
+            SDL_Rect destRect;
+            SDL_RendererFlip flip = SDL_FLIP_NONE;
+            double angle = 0;
+            SDL_Point center{};
+            bool hasCenter = false;
+            SDL_Color color = { 0xff, 0xff, 0xff, SDL_ALPHA_OPAQUE };
+        };
+
+        /**
+         * @brief Draw calls and quads submitted by every instance, per frame.
+        */
+        struct Data_Stats {
+            std::size_t drawCallCount = 0;
+            std::size_t quadCount = 0;
+        };
+
+        SpriteBatch() = default;
+        ~SpriteBatch() = default;
+
+        SpriteBatch(SpriteBatch const&) = delete;
+        SpriteBatch& operator=(SpriteBatch const&) = delete;
+
+        void draw(Data_Quad const& quad, int layer = 0);
+        inline void draw(SDL_Texture* texture, SDL_Rect const& srcRect, SDL_Rect const& destRect, int layer = 0) { draw({ texture, srcRect, destRect }, layer); }
+        void flush(SDL_Renderer* renderer);
+        void clear();
+
+        inline bool empty() const { return !mPendingCount; }
+        bool contains(SDL_Texture* texture) const;
+
+        static void endFrame();
+        inline static Data_Stats const& getStats() { return sPrevStats; }
+
+    private:
+        void submit(SDL_Renderer* renderer, std::vector<Data_Quad> const& quads, std::size_t begin, std::size_t end);
+        void submitFallback(SDL_Renderer* renderer, std::vector<Data_Quad> const& quads, std::size_t begin, std::size_t end);
+
+        std::map<int, std::vector<Data_Quad>> mLayers;   // Emptied rather than erased on flush, to reuse capacities
+        std::size_t mPendingCount = 0;
+
+        #if SDL_VERSION_ATLEAST(2, 0, 18)
+        std::vector<SDL_Vertex> mVertices;
+        std::vector<int> mIndices;
+        #endif
+
+        static Data_Stats sStats;
+        static Data_Stats sPrevStats;   // Stats of the latest complete frame
+};
+
+
+#endif
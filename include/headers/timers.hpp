@@ -1,16 +1,70 @@
 #ifndef TIMER_H
 #define TIMER_H
 
+#include <array>
+#include <functional>
+#include <mutex>
+
 #include <SDL_timer.h>
 
 #include <meta.hpp>
 #include <auxiliaries.hpp>
 
 
+/**
+ * @brief A clock sampled once per frame via `tick()`, with sub-millisecond resolution. Every timer reads from the same snapshot, hence timings do not drift within a frame.
+ * @note The source defaults to `SDL_GetPerformanceCounter()`, and could be overridden e.g. for headless runs and replays.
+ * @note Scaling and pausing only affect the scaled ticks i.e. in-game time. Real ticks are unaffected.
+*/
+class FrameClock final {
+    public:
+        using Source = std::function<Uint64()>;
+
+        FrameClock() = default;
+        ~FrameClock() = default;
+
+        void tick();
+        void setSource(Source source, Uint64 frequency);
+        void resetSource();
+
+        void setScale(double scale);
+        void pause();
+        void unpause();
+
+        double getElapsedRealTicks() const;
+
+        inline unsigned int getTicks() const { return static_cast<unsigned int>(mTicks); }
+        inline unsigned int getRealTicks() const { return static_cast<unsigned int>(mRealTicks); }
+        inline double getDeltaTicks() const { return mDeltaTicks; }
+        inline double getScale() const { return mScale; }
+        inline bool isPaused() const { return mIsPaused; }
+
+    private:
+        Uint64 sample() const;
+        Uint64 getFrequency() const;
+
+        Source mSource;
+        Uint64 mFrequency = 0;
+        Uint64 mPrevCounter = 0;
+        bool mIsSampled = false;
+
+        double mTicks = 0;   // Scaled, in milliseconds
+        double mRealTicks = 0;   // In milliseconds
+        double mDeltaTicks = 0;   // Scaled, in milliseconds
+        double mScale = 1;
+        bool mIsPaused = false;
+};
+
+namespace globals {
+    extern FrameClock frameClock;
+}
+
+
 /* Abstract templates */
 
 /**
  * @brief Represent a generic timer. Provides common utilities.
+ * @note Reads real ticks from `globals::frameClock`.
  * @see https://lazyfoo.net/tutorials/SDL/23_advanced_timers/index.php
  * @note Credits are important!
 */
@@ -73,16 +127,87 @@ class FPSControlTimer final : public Singleton<FPSControlTimer>, public GenericT
         static constexpr unsigned int kTicksPerFrame = 1000 / config::game::FPS;
 };
 
-class CountdownTimer final : public GenericTimer {
+/**
+ * @brief A hierarchical timing wheel. Driven once per frame via `advance()`, in terms of the scaled ticks of `globals::frameClock`.
+ * @note `kLevelCount` levels of `kSlotCount` slots each, with a resolution of one millisecond. Level `i` spans `kSlotCount^(i + 1)` milliseconds; timers are cascaded to lower levels as their expiry draws near, hence the cost per frame is proportional to the number of expiring timers rather than the number of scheduled ones.
+ * @note Timers beyond the span of the highest level are clamped to it.
+ * @note Scheduling and cancellation are thread-safe. Polling a node is not synchronized against `advance()`, which should therefore not overlap with parallel updates.
+*/
+class TimingWheel final {
     public:
-        CountdownTimer(unsigned int maxTicks = 1000) { setMaxTicks(maxTicks); }
-        ~CountdownTimer() = default;
+        /**
+         * @brief An intrusive node i.e. a timer handle, owned by the caller. Scheduling and cancellation are `O(1)`.
+         * @param callback called upon expiry, if any. Might reschedule the node.
+         * @note Recommended implementation: the node should be cancelled prior to its destruction.
+        */
+        struct Data_Node {
+            Data_Node* prev = nullptr;
+            Data_Node* next = nullptr;
+            Data_Node** slot = nullptr;
+
+            unsigned int expiryTicks = 0;
+            bool isExpired = false;
+            std::function<void()> callback;
+
+            inline bool isScheduled() const { return slot != nullptr; }
+        };
+
+        TimingWheel() = default;
+        ~TimingWheel() = default;
 
-        inline bool isFinished() const { return getTicks() >= mMaxTicks; }
-        inline void setMaxTicks(unsigned int maxTicks) { mMaxTicks = maxTicks; }
+        void schedule(Data_Node& node, unsigned int expiryTicks);
+        void cancel(Data_Node& node);
+        void advance();
+        void advance(unsigned int ticks);
+
+        inline unsigned int getTicks() const { return mTicks; }
 
     private:
+        static constexpr unsigned int kLevelBits = 6;
+        static constexpr unsigned int kLevelCount = 4;
+        static constexpr unsigned int kSlotCount = 1 << kLevelBits;
+        static constexpr unsigned int kSlotMask = kSlotCount - 1;
+
+        void insert(Data_Node& node);
+        void expire(Data_Node& node);
+        void cascade(unsigned int level);
+
+        std::array<std::array<Data_Node*, kSlotCount>, kLevelCount> mSlots{};
+        unsigned int mTicks = 0;   // The latest processed tick
+        std::size_t mSize = 0;
+
+        std::recursive_mutex mMutex;   // Timers might be started from `globals::jobs` workers. Recursive since callbacks might reschedule
+};
+
+namespace globals {
+    extern TimingWheel wheel;
+}
+
+
+/**
+ * @brief Represent a countdown, implemented as a handle to `globals::wheel`.
+ * @note Ticks are read from `globals::wheel` i.e. sampled once per frame. Pausing `globals::frameClock` pauses every countdown.
+*/
+class CountdownTimer final {
+    public:
+        CountdownTimer(unsigned int maxTicks = 1000, std::function<void()> callback = nullptr);
+        ~CountdownTimer();
+
+        CountdownTimer(CountdownTimer const&) = delete;
+        CountdownTimer& operator=(CountdownTimer const&) = delete;
+
+        void start();
+        void stop();
+        void setMaxTicks(unsigned int maxTicks);
+
+        inline bool isStarted() const { return mIsStarted; }
+        inline bool isFinished() const { return mIsStarted ? mNode.isExpired : !mMaxTicks; }
+
+    private:
+        TimingWheel::Data_Node mNode;
+        unsigned int mStartTicks = 0;
         unsigned int mMaxTicks;
+        bool mIsStarted = false;
 };
 
 
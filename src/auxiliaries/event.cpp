@@ -19,42 +19,17 @@ SDL_Event event::instantiate() {
 }
 
 /**
- * @brief Deallocate `event.user.data1` and `event.user.data2`.
- * @note Assume `event.user.data1` type matches `event.user.code`.
- * @warning Might be prone to memory leaks.
+ * @note Payloads need not be deallocated, since they are reclaimed along with `globals::arena` at the end of the frame.
 */
-void event::terminate(SDL_Event const& event) {
-    // Deleting `void*` is undefined
-    switch (event::getCode(event)) {
-        case event::Code::kReq_DeathPending_Player:
-        case event::Code::kReq_DeathFinalized_Player:
-            event::__deallocate__<event::ID>(event);
-            break;
-
-        case event::Code::kReq_AttackRegister_Player_GHE:
-        case event::Code::kReq_AttackRegister_GHE_Player:
-        case event::Code::kReq_AttackInitiate_GHE_Player:
-        case event::Code::kReq_MoveInitiate_GHE_Player:
-        case event::Code::kResp_AttackInitiate_GHE_Player:
-        case event::Code::kResp_MoveInitiate_GHE_Player:
-        case event::Code::kResp_MoveTerminate_GHE_Player:
-            event::__deallocate__<event::Data_Generic>(event);
-            break;
-
-        case event::Code::kReq_Teleport_GTE_Player:
-        case event::Code::kResp_Teleport_GTE_Player:
-            event::__deallocate__<event::Data_Teleporter>(event);
-            break;
-        
-        default: break;
-    }
-
-    if (event.user.data2 != nullptr) delete reinterpret_cast<event::ID*>(event.user.data2);
-}
-
 void event::enqueue(SDL_Event& event) {
     if (event.user.data1 != nullptr) SDL_PushEvent(&event);
-    else delete reinterpret_cast<event::ID*>(event.user.data2);
+}
+
+/**
+ * @brief Allocate storage for a payload from `globals::arena`.
+*/
+void* event::allocate(std::size_t bytes, std::size_t alignment) {
+    return globals::arena.allocate(bytes, alignment);
 }
 
 event::ID event::getID(SDL_Event const& event) {
@@ -62,8 +37,7 @@ event::ID event::getID(SDL_Event const& event) {
 }
 
 void event::setID(SDL_Event& event, int id) {
-    if (event.user.data2 != nullptr) delete reinterpret_cast<event::ID*>(event.user.data2);
-    event.user.data2 = new event::ID(id);
+    event.user.data2 = new (allocate(sizeof(event::ID), alignof(event::ID))) event::ID(id);
 }
 
 event::Code event::getCode(SDL_Event const& event) {
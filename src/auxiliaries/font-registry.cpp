@@ -0,0 +1,99 @@
+#include <font-registry.hpp>
+
+#include <auxiliaries.hpp>
+
+
+/**
+ * @return A handle to the font at `path` in `size` points, opening it only if no one holds it already. Every successful call must be paired with `release()`.
+*/
+TTF_Font* FontRegistry::acquire(std::filesystem::path const& path, int size) {
+    if (size <= 0) return nullptr;
+
+    Key key = { path.generic_string(), size };
+
+    auto it = mFonts.find(key);
+    if (it != mFonts.end()) {
+        ++it->second.refCount;
+        return it->second.font;
+    }
+
+    auto file = loadFile(key.first);
+    if (file == nullptr) return nullptr;
+
+    TTF_Font* font = TTF_OpenFontRW(SDL_RWFromConstMem(file->data(), static_cast<int>(file->size())), 1, size);
+    if (font == nullptr) return nullptr;
+
+    it = mFonts.try_emplace(std::move(key)).first;
+    it->second.font = font;
+    it->second.glyphAtlas.load(font);
+    it->second.refCount = 1;
+    mHandles[font] = it;
+
+    return font;
+}
+
+/**
+ * @brief Close `font` once no one holds it anymore. The file it was opened from remains in memory.
+*/
+void FontRegistry::release(TTF_Font* font) {
+    auto handle = mHandles.find(font);
+    if (handle == mHandles.end()) return;
+
+    auto it = handle->second;
+    if (--it->second.refCount) return;
+
+    it->second.glyphAtlas.clear();
+    TTF_CloseFont(it->second.font);
+
+    mHandles.erase(handle);
+    mFonts.erase(it);
+}
+
+/**
+ * @brief Close every font regardless of holders, then release their files.
+ * @note Recommended implementation: this method should be called once, prior to `TTF_Quit()`.
+*/
+void FontRegistry::clear() {
+    for (auto& [key, data] : mFonts) {
+        data.glyphAtlas.clear();
+        TTF_CloseFont(data.font);
+    }
+
+    mHandles.clear();
+    mFonts.clear();
+    mFiles.clear();
+}
+
+/**
+ * @return The glyph atlas shared by every holder of `font`, or `nullptr` if `font` was not acquired via this registry.
+*/
+GlyphAtlas* FontRegistry::getGlyphAtlas(TTF_Font* font) {
+    auto handle = mHandles.find(font);
+    return handle != mHandles.end() ? &handle->second->second.glyphAtlas : nullptr;
+}
+
+/**
+ * @return The contents of the file at `path`, read on the first request only, or `nullptr` should it fail to be read.
+ * @note Failures are not cached, hence are retried upon the next request.
+*/
+std::vector<char> const* FontRegistry::loadFile(std::string const& path) {
+    auto it = mFiles.find(path);
+    if (it != mFiles.end()) return &it->second;
+
+    SDL_RWops* rw = SDL_RWFromFile(path.c_str(), "rb");
+    if (rw == nullptr) return nullptr;
+
+    std::vector<char> data;
+    const Sint64 size = SDL_RWsize(rw);
+    if (size > 0) {
+        data.resize(static_cast<std::size_t>(size));
+        if (SDL_RWread(rw, data.data(), 1, data.size()) != data.size()) data.clear();
+    }
+    SDL_RWclose(rw);
+
+    if (data.empty()) return nullptr;
+    return &mFiles.emplace(path, std::move(data)).first->second;
+}
+
+
+FontRegistry globals::fonts;
@@ -0,0 +1,179 @@
+#include <glyph-atlas.hpp>
+
+#include <algorithm>
+
+#include <auxiliaries.hpp>
+
+
+namespace {
+    /**
+     * @brief Decode the UTF-8 sequence starting at `index`, then advance `index` past it.
+     * @note Malformed sequences decode to U+FFFD, one byte at a time.
+    */
+    Uint32 decodeUTF8(std::string const& text, std::size_t& index) {
+        constexpr Uint32 kReplacement = 0xfffd;
+
+        const auto lead = static_cast<unsigned char>(text[index++]);
+        if (lead < 0x80) return lead;
+
+        std::size_t length;
+        Uint32 codepoint;
+        if ((lead & 0xe0) == 0xc0) { length = 1; codepoint = lead & 0x1f; }
+        else if ((lead & 0xf0) == 0xe0) { length = 2; codepoint = lead & 0x0f; }
+        else if ((lead & 0xf8) == 0xf0) { length = 3; codepoint = lead & 0x07; }
+        else return kReplacement;
+
+        if (index + length > text.size()) return kReplacement;
+        for (std::size_t i = 0; i < length; ++i) {
+            const auto continuation = static_cast<unsigned char>(text[index + i]);
+            if ((continuation & 0xc0) != 0x80) return kReplacement;
+            codepoint = codepoint << 6 | (continuation & 0x3f);
+        }
+
+        index += length;
+        return codepoint;
+    }
+}
+
+
+/**
+ * @brief Bind `font`, discarding glyphs and layouts of the previous one.
+ * @note Glyphs are not rasterized until first laid out.
+*/
+void GlyphAtlas::load(TTF_Font* font) {
+    clear();
+    mFont = font;
+}
+
+void GlyphAtlas::clear() {
+    for (auto page : mPages) SDL_DestroyTexture(page);
+    mPages.clear();
+    mShelfOrigin = { 0, 0 };
+    mShelfHeight = 0;
+
+    mGlyphs.clear();
+    mLayouts.clear();
+    mFont = nullptr;
+}
+
+/**
+ * @return The layout of `text`, rasterizing glyphs not yet encountered. Cached, hence subsequent calls with the same `text` cost a single lookup.
+ * @note The returned reference is invalidated by subsequent calls.
+*/
+GlyphAtlas::Data_Layout const& GlyphAtlas::layout(std::string const& text) {
+    auto it = mLayouts.find(text);
+    if (it != mLayouts.end()) return it->second;
+
+    if (mLayouts.size() >= config::text::layoutCacheCapacity) mLayouts.clear();   // Layouts are cheap to recompute once their glyphs are rasterized
+
+    Data_Layout layout;
+    if (mFont != nullptr) {
+        layout.size.y = TTF_FontHeight(mFont);
+
+        int penX = 0;
+        Uint32 prevCodepoint = 0;
+
+        for (std::size_t index = 0; index < text.size();) {
+            const auto codepoint = decodeUTF8(text, index);
+            if (prevCodepoint) penX += TTF_GetFontKerningSizeGlyphs32(mFont, prevCodepoint, codepoint);
+
+            auto const& glyph = getGlyph(codepoint);
+            if (glyph.texture != nullptr) {
+                SpriteBatch::Data_Quad quad;
+                quad.texture = glyph.texture;
+                quad.srcRect = glyph.srcRect;
+                quad.destRect = { penX + glyph.offset.x, glyph.offset.y, glyph.srcRect.w, glyph.srcRect.h };
+                layout.quads.push_back(quad);
+                layout.size.x = std::max(layout.size.x, quad.destRect.x + quad.destRect.w);
+            }
+
+            penX += glyph.advance;
+            layout.size.x = std::max(layout.size.x, penX);
+            prevCodepoint = codepoint;
+        }
+    }
+
+    return mLayouts.emplace(text, std::move(layout)).first->second;
+}
+
+/**
+ * @brief Queue `text` into `batch`, with its top-left corner at `destCoords`.
+*/
+void GlyphAtlas::render(SpriteBatch& batch, std::string const& text, SDL_Point const& destCoords, SDL_Color const& color, int layer) {
+    for (auto quad : layout(text).quads) {
+        quad.destRect.x += destCoords.x;
+        quad.destRect.y += destCoords.y;
+        quad.color = color;
+        batch.draw(quad, layer);
+    }
+}
+
+GlyphAtlas::Data_Glyph const& GlyphAtlas::getGlyph(Uint32 codepoint) {
+    auto it = mGlyphs.find(codepoint);
+    if (it != mGlyphs.end()) return it->second;
+    return mGlyphs.emplace(codepoint, rasterize(codepoint)).first->second;
+}
+
+/**
+ * @brief Render `codepoint` in white, then upload it into the current page.
+ * @note Glyphs are rendered individually, hence are offset by their negative left bearing, if any, as `TTF_RenderUTF8_Blended()` would.
+*/
+GlyphAtlas::Data_Glyph GlyphAtlas::rasterize(Uint32 codepoint) {
+    Data_Glyph glyph;
+
+    int minX, maxX, minY, maxY;
+    if (TTF_GlyphMetrics32(mFont, codepoint, &minX, &maxX, &minY, &maxY, &glyph.advance) || maxX <= minX) return glyph;   // Missing or blank glyph
+
+    SDL_Surface* surface = TTF_RenderGlyph32_Blended(mFont, codepoint, { 0xff, 0xff, 0xff, SDL_ALPHA_OPAQUE });
+    if (surface == nullptr) return glyph;
+
+    SDL_Surface* convertedSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(surface);
+    if (convertedSurface == nullptr) return glyph;
+
+    glyph.texture = allocate({ convertedSurface->w, convertedSurface->h }, glyph.srcRect);
+    if (glyph.texture != nullptr) {
+        SDL_UpdateTexture(glyph.texture, &glyph.srcRect, convertedSurface->pixels, convertedSurface->pitch);
+        glyph.offset = { std::min(minX, 0), 0 };
+    }
+
+    SDL_FreeSurface(convertedSurface);
+    return glyph;
+}
+
+/**
+ * @brief Reserve a `size` region in the current page via shelf packing, creating a new page if full.
+ * @return The page `srcRect` was reserved within, or `nullptr` if `size` exceeds a page.
+ * @note Regions are padded by 1 pixel to prevent neighbouring glyphs from bleeding into each other under linear filtering.
+*/
+SDL_Texture* GlyphAtlas::allocate(SDL_Point const& size, SDL_Rect& srcRect) {
+    constexpr int kPadding = 1;
+    constexpr int kPageSize = config::text::glyphAtlasPageSize;
+    if (size.x <= 0 || size.y <= 0 || size.x + kPadding > kPageSize || size.y + kPadding > kPageSize) return nullptr;
+
+    // Start a new shelf
+    if (!mPages.empty() && mShelfOrigin.x + size.x + kPadding > kPageSize) {
+        mShelfOrigin = { 0, mShelfOrigin.y + mShelfHeight };
+        mShelfHeight = 0;
+    }
+
+    // Start a new page
+    if (mPages.empty() || mShelfOrigin.y + size.y + kPadding > kPageSize) {
+        SDL_Texture* page = SDL_CreateTexture(globals::renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, kPageSize, kPageSize);
+        if (page == nullptr) return nullptr;
+
+        const std::vector<Uint32> transparentPixels(kPageSize * kPageSize, 0);   // Static textures are not guaranteed to be initialized
+        SDL_UpdateTexture(page, nullptr, transparentPixels.data(), kPageSize * sizeof(Uint32));
+        SDL_SetTextureBlendMode(page, SDL_BLENDMODE_BLEND);
+
+        mPages.push_back(page);
+        mShelfOrigin = { 0, 0 };
+        mShelfHeight = 0;
+    }
+
+    srcRect = { mShelfOrigin.x, mShelfOrigin.y, size.x, size.y };
+    mShelfOrigin.x += size.x + kPadding;
+    mShelfHeight = std::max(mShelfHeight, size.y + kPadding);
+
+    return mPages.back();
+}
@@ -0,0 +1,120 @@
+#include <job-system.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include <auxiliaries.hpp>
+
+
+/**
+ * @param workerCount the number of threads besides the calling one. Zero disables the pool altogether.
+ * @note Recommended implementation: this method should be called once, from the main thread.
+*/
+void JobSystem::initialize(std::size_t workerCount) {
+    if (!mWorkers.empty()) return;
+
+    mIsTerminated = false;
+    mQueueCount = workerCount + 1;
+    mQueues = std::make_unique<Data_Queue[]>(mQueueCount);
+
+    sQueueIndex = 0;
+    mWorkers.reserve(workerCount);
+    for (std::size_t index = 1; index < mQueueCount; ++index) mWorkers.emplace_back(&JobSystem::run, this, index);
+}
+
+/**
+ * @brief Join every worker. Jobs still queued are discarded.
+*/
+void JobSystem::terminate() {
+    if (mWorkers.empty()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mIsTerminated = true;
+    }
+    mCondition.notify_all();
+
+    for (auto& worker : mWorkers) worker.join();
+    mWorkers.clear();
+
+    mQueues.reset();
+    mQueueCount = 1;
+    mPendingCount = 0;
+}
+
+void JobSystem::submit(Data_Job&& job) {
+    ++mPendingCount;   // Prior to pushing, so that the count never underflows
+    {
+        auto& queue = mQueues[sQueueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+
+    { std::lock_guard<std::mutex> lock(mMutex); }   // Prevent a worker from missing the notification between its check and its wait
+    mCondition.notify_one();
+}
+
+/**
+ * @brief Help execute pending jobs until every job of the batch associated with `counter` has finished.
+*/
+void JobSystem::wait(std::atomic<std::size_t>& counter) {
+    while (counter.load(std::memory_order_acquire)) if (!execute()) std::this_thread::yield();
+}
+
+/**
+ * @brief Pop a job from the back of the own queue, or steal one from the front of another, then execute it.
+ * @return `false` if there was nothing to execute.
+*/
+bool JobSystem::execute() {
+    Data_Job job;
+    bool isFound = false;
+
+    for (std::size_t offset = 0; offset < mQueueCount && !isFound; ++offset) {
+        auto& queue = mQueues[(sQueueIndex + offset) % mQueueCount];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty()) continue;
+
+        if (!offset) {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+        } else {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+        }
+        isFound = true;
+    }
+
+    if (!isFound) return false;
+
+    --mPendingCount;
+    job.task();
+    job.counter->fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+void JobSystem::run(std::size_t index) {
+    sQueueIndex = index;
+
+    while (true) {
+        if (execute()) continue;
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [&]() { return mIsTerminated || mPendingCount > 0; });
+        if (mIsTerminated) return;
+    }
+}
+
+
+/**
+ * @return The number of workers to spawn besides the main thread i.e. one less than the number of hardware threads.
+ * @note Defined out of line rather than as a constant of `config::game`, which would be dynamically initialized once per translation unit including the configuration.
+*/
+std::size_t config::game::jobWorkerCount() {
+    return std::max(std::thread::hardware_concurrency(), 1u) - 1;
+}
+
+
+thread_local std::size_t JobSystem::sQueueIndex = 0;
+
+JobSystem globals::jobs;
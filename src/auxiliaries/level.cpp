@@ -1,7 +1,9 @@
 #include <auxiliaries.hpp>
 
+#include <algorithm>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 
 
 /**
@@ -159,9 +161,14 @@ void level::Data_Teleporter::load(json const& JSONObjectData) {
     }
 }
 
-std::vector<level::Data_Generic*> level::Data::get(std::string const& key) {
+/**
+ * @note The returned copy is allocated from `globals::arena`, hence should not outlive the current frame.
+*/
+std::pmr::vector<level::Data_Generic*> level::Data::get(std::string const& key) {
+    std::pmr::vector<level::Data_Generic*> result(&globals::arena);
     auto it = dependencies.find(key);
-    return it != dependencies.end() ? it->second : std::vector<level::Data_Generic*>{};
+    if (it != dependencies.end()) result.assign(it->second.begin(), it->second.end());
+    return result;
 }
 
 void level::Data::insert(std::string const& key, Data_Generic* data) {
@@ -240,6 +247,7 @@ void level::Data::load(json const& JSONLevelData) {
     loadProperties(JSONLevelData);
     loadLayers(JSONLevelData);
     loadTilelayerTilesets(JSONLevelData);
+    loadDrawLists();
 }
 
 void level::Data::loadProperties(json const& JSONLevelData) {
@@ -382,6 +390,61 @@ void level::Data::loadTilelayerTilesets(json const& JSONLevelData) {
     tilesets.load(JSONLevelData, globals::renderer);
 }
 
+/**
+ * @brief Compile the tilelayers of every chunk into draw lists.
+ * @note Requires `tiles` and `tilesets` to be loaded.
+*/
+void level::Data::loadDrawLists() {
+    constexpr int N = config::interface::mapChunkTileCount;
+    const SDL_Point chunkCount = { (tileDestCount.x + N - 1) / N, (tileDestCount.y + N - 1) / N };
+
+    drawLists.assign(chunkCount.x * chunkCount.y, {});
+    for (int y = 0; y < chunkCount.y; ++y) for (int x = 0; x < chunkCount.x; ++x) loadDrawList({ x, y });
+}
+
+/**
+ * @brief Compile the tilelayers of the chunk at `chunkCoords` into one draw list per tilelayer. Empty, invalid and `"norender"` tiles are dropped, and each list is sorted by texture, hence baking a chunk is a mere replay of its draw lists.
+ * @note Should be called again on the affected chunk whenever `tiles` is manipulated.
+*/
+void level::Data::loadDrawList(SDL_Point const& chunkCoords) {
+    constexpr int N = config::interface::mapChunkTileCount;
+    const auto index = static_cast<std::size_t>(chunkCoords.y * ((tileDestCount.x + N - 1) / N) + chunkCoords.x);
+    if (index >= drawLists.size()) return;
+
+    auto& layers = drawLists[index];
+    for (auto& drawList : layers) drawList.clear();
+
+    std::unordered_map<tile::GID, tile::Data_TilelayerTileset const*> lookup;   // Memoizes `Data_TilelayerTilesets::find()` and the `"norender"` check, per GID
+
+    for (int y = chunkCoords.y * N; y < std::min((chunkCoords.y + 1) * N, tileDestCount.y); ++y) {
+        for (int x = chunkCoords.x * N; x < std::min((chunkCoords.x + 1) * N, tileDestCount.x); ++x) {
+            auto const& GIDs = tiles[y][x];
+            if (layers.size() < GIDs.size()) layers.resize(GIDs.size());
+
+            for (std::size_t layer = 0; layer < GIDs.size(); ++layer) {
+                auto gid = GIDs[layer];
+                if (!gid) continue;   // A GID value of `0` represents an "empty" tile i.e. associated with no tileset
+
+                auto [it, isInserted] = lookup.try_emplace(gid, nullptr);
+                if (isInserted) {
+                    auto tileset = tilesets.find(gid);
+                    if (tileset != nullptr) {
+                        auto norender = tileset->properties.find("norender");
+                        if (norender == tileset->properties.end() || norender->second != "true") it->second = tileset;   // Otherwise GID is for non-render purposes e.g. collision
+                    }
+                }
+                if (it->second == nullptr) continue;
+
+                layers[layer].push_back({ it->second, it->second->getSrcRect(gid), { x, y }, gid });
+            }
+        }
+    }
+
+    for (auto& drawList : layers) std::stable_sort(drawList.begin(), drawList.end(), [](tile::Data_TileDraw const& lhs, tile::Data_TileDraw const& rhs) {
+        return lhs.tileset->texture < rhs.tileset->texture;   // Tiles of the same layer never overlap, hence any order is valid
+    });
+}
+
 /**
  * @note When entry `key` is removed via `erase(key)`, iterators pointing to next entries are invalidated i.e. undefined behaviour with `for (auto& pair : dependencies) erase(pair.first);`
 */
@@ -390,6 +453,8 @@ void level::Data::clear() {
     tiles.shrink_to_fit();
     collisionTilelayer.clear();
     collisionTilelayer.shrink_to_fit();
+    drawLists.clear();
+    drawLists.shrink_to_fit();
 
     // Default properties
     viewportHeight = config::interface::viewportHeight;
@@ -401,4 +466,34 @@ void level::Data::clear() {
 }
 
 
-level::Data level::data;
\ No newline at end of file
+/**
+ * @return `true` if `rect`, in level coordinates, overlaps `viewport`.
+*/
+bool level::Data_Camera::isVisible(SDL_Rect const& rect) const {
+    return rect.x < viewport.x + viewport.w && viewport.x < rect.x + rect.w && rect.y < viewport.y + viewport.h && viewport.y < rect.y + rect.h;
+}
+
+/**
+ * @brief Convert `rect` from level coordinates to window coordinates.
+ * @note Edges are projected independently, hence adjacent rects remain adjacent i.e. no seams appear between tiles under non-integral scaling.
+*/
+SDL_Rect level::Data_Camera::project(SDL_Rect const& rect) const {
+    auto projectEdge = [](int value, int srcOrigin, int srcSize, int destOrigin, int destSize) {
+        if (srcSize <= 0) return destOrigin;
+        auto numerator = static_cast<long long int>(value - srcOrigin) * destSize;
+        auto quotient = numerator / srcSize;
+        if (numerator % srcSize && numerator < 0) --quotient;   // Round towards negative infinity
+        return destOrigin + static_cast<int>(quotient);
+    };
+
+    int x0 = projectEdge(rect.x, viewport.x, viewport.w, destRect.x, destRect.w);
+    int y0 = projectEdge(rect.y, viewport.y, viewport.h, destRect.y, destRect.h);
+    int x1 = projectEdge(rect.x + rect.w, viewport.x, viewport.w, destRect.x, destRect.w);
+    int y1 = projectEdge(rect.y + rect.h, viewport.y, viewport.h, destRect.y, destRect.h);
+
+    return { x0, y0, x1 - x0, y1 - y0 };
+}
+
+
+level::Data level::data;
+level::Data_Camera level::camera;
\ No newline at end of file
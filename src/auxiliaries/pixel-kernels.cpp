@@ -0,0 +1,494 @@
+#include <pixel-kernels.hpp>
+
+#include <optional>
+
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define PIXEL_KERNELS_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#define PIXEL_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace {
+    // Channel offsets within a `SDL_PIXELFORMAT_RGBA32` pixel, read as a native `std::uint32_t`
+    #if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    constexpr unsigned int kShiftR = 0, kShiftG = 8, kShiftB = 16, kShiftA = 24;
+    #else
+    constexpr unsigned int kShiftR = 24, kShiftG = 16, kShiftB = 8, kShiftA = 0;
+    #endif
+
+    constexpr std::uint32_t kMaskA = 0xffu << kShiftA;
+    constexpr std::uint32_t kMaskRGB = ~kMaskA;
+
+    // BT.709 luma coefficients, scaled to sum up to `256`
+    constexpr std::uint32_t kWeightR = 54, kWeightG = 183, kWeightB = 19;
+
+    /**
+     * @note Every intermediate product below fits in 16 bits, which is what allows SSE2 to multiply 32-bit lanes via `_mm_mullo_epi16()`.
+    */
+    namespace scalar {
+        inline std::uint32_t channel(std::uint32_t pixel, unsigned int shift) { return pixel >> shift & 0xff; }
+
+        /**
+         * @return `round(x / 255)`, exact for `x` in `[0, 255 * 255]`.
+        */
+        inline std::uint32_t div255(std::uint32_t x) {
+            x += 128;
+            return (x + (x >> 8)) >> 8;
+        }
+
+        void grayscale(std::uint32_t* pixels, std::size_t count, unsigned int intensity) {
+            const std::uint32_t inverse = 256 - intensity;
+
+            for (std::size_t index = 0; index < count; ++index) {
+                auto& pixel = pixels[index];
+                auto r = channel(pixel, kShiftR), g = channel(pixel, kShiftG), b = channel(pixel, kShiftB);
+                auto gray = ((r * kWeightR + g * kWeightG + b * kWeightB + 128) >> 8) * intensity + 128;
+
+                pixel = (pixel & kMaskA)
+                    | (r * inverse + gray) >> 8 << kShiftR
+                    | (g * inverse + gray) >> 8 << kShiftG
+                    | (b * inverse + gray) >> 8 << kShiftB;
+            }
+        }
+
+        void tint(std::uint32_t* pixels, std::size_t count, SDL_Color const& color) {
+            for (std::size_t index = 0; index < count; ++index) {
+                auto& pixel = pixels[index];
+                pixel = div255(channel(pixel, kShiftR) * color.r) << kShiftR
+                    | div255(channel(pixel, kShiftG) * color.g) << kShiftG
+                    | div255(channel(pixel, kShiftB) * color.b) << kShiftB
+                    | div255(channel(pixel, kShiftA) * color.a) << kShiftA;
+            }
+        }
+
+        void premultiplyAlpha(std::uint32_t* pixels, std::size_t count) {
+            for (std::size_t index = 0; index < count; ++index) {
+                auto& pixel = pixels[index];
+                auto a = channel(pixel, kShiftA);
+                pixel = (pixel & kMaskA)
+                    | div255(channel(pixel, kShiftR) * a) << kShiftR
+                    | div255(channel(pixel, kShiftG) * a) << kShiftG
+                    | div255(channel(pixel, kShiftB) * a) << kShiftB;
+            }
+        }
+
+        void colorKey(std::uint32_t* pixels, std::size_t count, std::uint32_t key) {
+            for (std::size_t index = 0; index < count; ++index) if ((pixels[index] & kMaskRGB) == key) pixels[index] &= kMaskRGB;
+        }
+    }
+
+    #if defined(PIXEL_KERNELS_X86)
+    namespace sse2 {
+        constexpr std::size_t kWidth = 4;
+
+        __attribute__((target("sse2"))) inline __m128i channel(__m128i pixels, unsigned int shift) { return _mm_and_si128(_mm_srli_epi32(pixels, shift), _mm_set1_epi32(0xff)); }
+
+        __attribute__((target("sse2"))) inline __m128i div255(__m128i x) {
+            x = _mm_add_epi32(x, _mm_set1_epi32(128));
+            return _mm_srli_epi32(_mm_add_epi32(x, _mm_srli_epi32(x, 8)), 8);
+        }
+
+        __attribute__((target("sse2"))) void grayscale(std::uint32_t* pixels, std::size_t count, unsigned int intensity) {
+            const __m128i weightR = _mm_set1_epi32(kWeightR), weightG = _mm_set1_epi32(kWeightG), weightB = _mm_set1_epi32(kWeightB);
+            const __m128i scale = _mm_set1_epi32(intensity), inverse = _mm_set1_epi32(256 - intensity), half = _mm_set1_epi32(128), maskA = _mm_set1_epi32(kMaskA);
+
+            std::size_t index = 0;
+            for (; index + kWidth <= count; index += kWidth) {
+                auto ptr = reinterpret_cast<__m128i*>(pixels + index);
+                __m128i p = _mm_loadu_si128(ptr);
+                __m128i r = channel(p, kShiftR), g = channel(p, kShiftG), b = channel(p, kShiftB);
+
+                __m128i gray = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(_mm_mullo_epi16(r, weightR), _mm_mullo_epi16(g, weightG)), _mm_add_epi32(_mm_mullo_epi16(b, weightB), half)), 8);
+                gray = _mm_add_epi32(_mm_mullo_epi16(gray, scale), half);
+
+                r = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(r, inverse), gray), 8);
+                g = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(g, inverse), gray), 8);
+                b = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(b, inverse), gray), 8);
+
+                p = _mm_or_si128(_mm_and_si128(p, maskA), _mm_or_si128(_mm_slli_epi32(r, kShiftR), _mm_or_si128(_mm_slli_epi32(g, kShiftG), _mm_slli_epi32(b, kShiftB))));
+                _mm_storeu_si128(ptr, p);
+            }
+
+            scalar::grayscale(pixels + index, count - index, intensity);
+        }
+
+        __attribute__((target("sse2"))) void tint(std::uint32_t* pixels, std::size_t count, SDL_Color const& color) {
+            const __m128i tintR = _mm_set1_epi32(color.r), tintG = _mm_set1_epi32(color.g), tintB = _mm_set1_epi32(color.b), tintA = _mm_set1_epi32(color.a);
+
+            std::size_t index = 0;
+            for (; index + kWidth <= count; index += kWidth) {
+                auto ptr = reinterpret_cast<__m128i*>(pixels + index);
+                __m128i p = _mm_loadu_si128(ptr);
+                __m128i r = div255(_mm_mullo_epi16(channel(p, kShiftR), tintR));
+                __m128i g = div255(_mm_mullo_epi16(channel(p, kShiftG), tintG));
+                __m128i b = div255(_mm_mullo_epi16(channel(p, kShiftB), tintB));
+                __m128i a = div255(_mm_mullo_epi16(channel(p, kShiftA), tintA));
+
+                p = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, kShiftR), _mm_slli_epi32(g, kShiftG)), _mm_or_si128(_mm_slli_epi32(b, kShiftB), _mm_slli_epi32(a, kShiftA)));
+                _mm_storeu_si128(ptr, p);
+            }
+
+            scalar::tint(pixels + index, count - index, color);
+        }
+
+        __attribute__((target("sse2"))) void premultiplyAlpha(std::uint32_t* pixels, std::size_t count) {
+            const __m128i maskA = _mm_set1_epi32(kMaskA);
+
+            std::size_t index = 0;
+            for (; index + kWidth <= count; index += kWidth) {
+                auto ptr = reinterpret_cast<__m128i*>(pixels + index);
+                __m128i p = _mm_loadu_si128(ptr);
+                __m128i a = channel(p, kShiftA);
+                __m128i r = div255(_mm_mullo_epi16(channel(p, kShiftR), a));
+                __m128i g = div255(_mm_mullo_epi16(channel(p, kShiftG), a));
+                __m128i b = div255(_mm_mullo_epi16(channel(p, kShiftB), a));
+
+                p = _mm_or_si128(_mm_and_si128(p, maskA), _mm_or_si128(_mm_slli_epi32(r, kShiftR), _mm_or_si128(_mm_slli_epi32(g, kShiftG), _mm_slli_epi32(b, kShiftB))));
+                _mm_storeu_si128(ptr, p);
+            }
+
+            scalar::premultiplyAlpha(pixels + index, count - index);
+        }
+
+        __attribute__((target("sse2"))) void colorKey(std::uint32_t* pixels, std::size_t count, std::uint32_t key) {
+            const __m128i keyRGB = _mm_set1_epi32(key), maskA = _mm_set1_epi32(kMaskA), maskRGB = _mm_set1_epi32(kMaskRGB);
+
+            std::size_t index = 0;
+            for (; index + kWidth <= count; index += kWidth) {
+                auto ptr = reinterpret_cast<__m128i*>(pixels + index);
+                __m128i p = _mm_loadu_si128(ptr);
+                __m128i isMatch = _mm_cmpeq_epi32(_mm_and_si128(p, maskRGB), keyRGB);
+                _mm_storeu_si128(ptr, _mm_andnot_si128(_mm_and_si128(isMatch, maskA), p));
+            }
+
+            scalar::colorKey(pixels + index, count - index, key);
+        }
+    }
+
+    namespace avx2 {
+        constexpr std::size_t kWidth = 8;
+
+        __attribute__((target("avx2"))) inline __m256i channel(__m256i pixels, unsigned int shift) { return _mm256_and_si256(_mm256_srli_epi32(pixels, shift), _mm256_set1_epi32(0xff)); }
+
+        __attribute__((target("avx2"))) inline __m256i div255(__m256i x) {
+            x = _mm256_add_epi32(x, _mm256_set1_epi32(128));
+            return _mm256_srli_epi32(_mm256_add_epi32(x, _mm256_srli_epi32(x, 8)), 8);
+        }
+
+        __attribute__((target("avx2"))) void grayscale(std::uint32_t* pixels, std::size_t count, unsigned int intensity) {
+            const __m256i weightR = _mm256_set1_epi32(kWeightR), weightG = _mm256_set1_epi32(kWeightG), weightB = _mm256_set1_epi32(kWeightB);
+            const __m256i scale = _mm256_set1_epi32(intensity), inverse = _mm256_set1_epi32(256 - intensity), half = _mm256_set1_epi32(128), maskA = _mm256_set1_epi32(kMaskA);
+
+            std::size_t index = 0;
+            for (; index + kWidth <= count; index += kWidth) {
+                auto ptr = reinterpret_cast<__m256i*>(pixels + index);
+                __m256i p = _mm256_loadu_si256(ptr);
+                __m256i r = channel(p, kShiftR), g = channel(p, kShiftG), b = channel(p, kShiftB);
+
+                __m256i gray = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(_mm256_mullo_epi16(r, weightR), _mm256_mullo_epi16(g, weightG)), _mm256_add_epi32(_mm256_mullo_epi16(b, weightB), half)), 8);
+                gray = _mm256_add_epi32(_mm256_mullo_epi16(gray, scale), half);
+
+                r = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi16(r, inverse), gray), 8);
+                g = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi16(g, inverse), gray), 8);
+                b = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi16(b, inverse), gray), 8);
+
+                p = _mm256_or_si256(_mm256_and_si256(p, maskA), _mm256_or_si256(_mm256_slli_epi32(r, kShiftR), _mm256_or_si256(_mm256_slli_epi32(g, kShiftG), _mm256_slli_epi32(b, kShiftB))));
+                _mm256_storeu_si256(ptr, p);
+            }
+
+            sse2::grayscale(pixels + index, count - index, intensity);
+        }
+
+        __attribute__((target("avx2"))) void tint(std::uint32_t* pixels, std::size_t count, SDL_Color const& color) {
+            const __m256i tintR = _mm256_set1_epi32(color.r), tintG = _mm256_set1_epi32(color.g), tintB = _mm256_set1_epi32(color.b), tintA = _mm256_set1_epi32(color.a);
+
+            std::size_t index = 0;
+            for (; index + kWidth <= count; index += kWidth) {
+                auto ptr = reinterpret_cast<__m256i*>(pixels + index);
+                __m256i p = _mm256_loadu_si256(ptr);
+                __m256i r = div255(_mm256_mullo_epi16(channel(p, kShiftR), tintR));
+                __m256i g = div255(_mm256_mullo_epi16(channel(p, kShiftG), tintG));
+                __m256i b = div255(_mm256_mullo_epi16(channel(p, kShiftB), tintB));
+                __m256i a = div255(_mm256_mullo_epi16(channel(p, kShiftA), tintA));
+
+                p = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(r, kShiftR), _mm256_slli_epi32(g, kShiftG)), _mm256_or_si256(_mm256_slli_epi32(b, kShiftB), _mm256_slli_epi32(a, kShiftA)));
+                _mm256_storeu_si256(ptr, p);
+            }
+
+            sse2::tint(pixels + index, count - index, color);
+        }
+
+        __attribute__((target("avx2"))) void premultiplyAlpha(std::uint32_t* pixels, std::size_t count) {
+            const __m256i maskA = _mm256_set1_epi32(kMaskA);
+
+            std::size_t index = 0;
+            for (; index + kWidth <= count; index += kWidth) {
+                auto ptr = reinterpret_cast<__m256i*>(pixels + index);
+                __m256i p = _mm256_loadu_si256(ptr);
+                __m256i a = channel(p, kShiftA);
+                __m256i r = div255(_mm256_mullo_epi16(channel(p, kShiftR), a));
+                __m256i g = div255(_mm256_mullo_epi16(channel(p, kShiftG), a));
+                __m256i b = div255(_mm256_mullo_epi16(channel(p, kShiftB), a));
+
+                p = _mm256_or_si256(_mm256_and_si256(p, maskA), _mm256_or_si256(_mm256_slli_epi32(r, kShiftR), _mm256_or_si256(_mm256_slli_epi32(g, kShiftG), _mm256_slli_epi32(b, kShiftB))));
+                _mm256_storeu_si256(ptr, p);
+            }
+
+            sse2::premultiplyAlpha(pixels + index, count - index);
+        }
+
+        __attribute__((target("avx2"))) void colorKey(std::uint32_t* pixels, std::size_t count, std::uint32_t key) {
+            const __m256i keyRGB = _mm256_set1_epi32(key), maskA = _mm256_set1_epi32(kMaskA), maskRGB = _mm256_set1_epi32(kMaskRGB);
+
+            std::size_t index = 0;
+            for (; index + kWidth <= count; index += kWidth) {
+                auto ptr = reinterpret_cast<__m256i*>(pixels + index);
+                __m256i p = _mm256_loadu_si256(ptr);
+                __m256i isMatch = _mm256_cmpeq_epi32(_mm256_and_si256(p, maskRGB), keyRGB);
+                _mm256_storeu_si256(ptr, _mm256_andnot_si256(_mm256_and_si256(isMatch, maskA), p));
+            }
+
+            sse2::colorKey(pixels + index, count - index, key);
+        }
+    }
+    #endif
+
+    #if defined(PIXEL_KERNELS_NEON)
+    namespace neon {
+        constexpr std::size_t kWidth = 4;
+
+        inline uint32x4_t channel(uint32x4_t pixels, unsigned int shift) { return vandq_u32(vshlq_u32(pixels, vdupq_n_s32(-static_cast<int>(shift))), vdupq_n_u32(0xff)); }   // `vshrq_n_u32()` rejects a shift of `0`
+        inline uint32x4_t place(uint32x4_t value, unsigned int shift) { return vshlq_u32(value, vdupq_n_s32(static_cast<int>(shift))); }
+
+        inline uint32x4_t div255(uint32x4_t x) {
+            x = vaddq_u32(x, vdupq_n_u32(128));
+            return vshrq_n_u32(vaddq_u32(x, vshrq_n_u32(x, 8)), 8);
+        }
+
+        void grayscale(std::uint32_t* pixels, std::size_t count, unsigned int intensity) {
+            const uint32x4_t scale = vdupq_n_u32(intensity), inverse = vdupq_n_u32(256 - intensity), half = vdupq_n_u32(128), maskA = vdupq_n_u32(kMaskA);
+
+            std::size_t index = 0;
+            for (; index + kWidth <= count; index += kWidth) {
+                uint32x4_t p = vld1q_u32(pixels + index);
+                uint32x4_t r = channel(p, kShiftR), g = channel(p, kShiftG), b = channel(p, kShiftB);
+
+                uint32x4_t gray = vmlaq_n_u32(vmlaq_n_u32(vmlaq_n_u32(half, r, kWeightR), g, kWeightG), b, kWeightB);
+                gray = vmlaq_u32(half, vshrq_n_u32(gray, 8), scale);
+
+                r = vshrq_n_u32(vmlaq_u32(gray, r, inverse), 8);
+                g = vshrq_n_u32(vmlaq_u32(gray, g, inverse), 8);
+                b = vshrq_n_u32(vmlaq_u32(gray, b, inverse), 8);
+
+                vst1q_u32(pixels + index, vorrq_u32(vandq_u32(p, maskA), vorrq_u32(place(r, kShiftR), vorrq_u32(place(g, kShiftG), place(b, kShiftB)))));
+            }
+
+            scalar::grayscale(pixels + index, count - index, intensity);
+        }
+
+        void tint(std::uint32_t* pixels, std::size_t count, SDL_Color const& color) {
+            std::size_t index = 0;
+            for (; index + kWidth <= count; index += kWidth) {
+                uint32x4_t p = vld1q_u32(pixels + index);
+                uint32x4_t r = div255(vmulq_n_u32(channel(p, kShiftR), color.r));
+                uint32x4_t g = div255(vmulq_n_u32(channel(p, kShiftG), color.g));
+                uint32x4_t b = div255(vmulq_n_u32(channel(p, kShiftB), color.b));
+                uint32x4_t a = div255(vmulq_n_u32(channel(p, kShiftA), color.a));
+
+                vst1q_u32(pixels + index, vorrq_u32(vorrq_u32(place(r, kShiftR), place(g, kShiftG)), vorrq_u32(place(b, kShiftB), place(a, kShiftA))));
+            }
+
+            scalar::tint(pixels + index, count - index, color);
+        }
+
+        void premultiplyAlpha(std::uint32_t* pixels, std::size_t count) {
+            const uint32x4_t maskA = vdupq_n_u32(kMaskA);
+
+            std::size_t index = 0;
+            for (; index + kWidth <= count; index += kWidth) {
+                uint32x4_t p = vld1q_u32(pixels + index);
+                uint32x4_t a = channel(p, kShiftA);
+                uint32x4_t r = div255(vmulq_u32(channel(p, kShiftR), a));
+                uint32x4_t g = div255(vmulq_u32(channel(p, kShiftG), a));
+                uint32x4_t b = div255(vmulq_u32(channel(p, kShiftB), a));
+
+                vst1q_u32(pixels + index, vorrq_u32(vandq_u32(p, maskA), vorrq_u32(place(r, kShiftR), vorrq_u32(place(g, kShiftG), place(b, kShiftB)))));
+            }
+
+            scalar::premultiplyAlpha(pixels + index, count - index);
+        }
+
+        void colorKey(std::uint32_t* pixels, std::size_t count, std::uint32_t key) {
+            const uint32x4_t keyRGB = vdupq_n_u32(key), maskA = vdupq_n_u32(kMaskA), maskRGB = vdupq_n_u32(kMaskRGB);
+
+            std::size_t index = 0;
+            for (; index + kWidth <= count; index += kWidth) {
+                uint32x4_t p = vld1q_u32(pixels + index);
+                uint32x4_t isMatch = vceqq_u32(vandq_u32(p, maskRGB), keyRGB);
+                vst1q_u32(pixels + index, vbicq_u32(p, vandq_u32(isMatch, maskA)));
+            }
+
+            scalar::colorKey(pixels + index, count - index, key);
+        }
+    }
+    #endif
+
+    struct Data_Kernels {
+        pixel::Backend backend;
+        void (*grayscale)(std::uint32_t*, std::size_t, unsigned int);
+        void (*tint)(std::uint32_t*, std::size_t, SDL_Color const&);
+        void (*premultiplyAlpha)(std::uint32_t*, std::size_t);
+        void (*colorKey)(std::uint32_t*, std::size_t, std::uint32_t);
+    };
+
+    /**
+     * @return The kernels of `backend`, or `std::nullopt` if not supported by the CPU.
+     * @note x86 paths are compiled via function attributes regardless of compiler flags, then gated by CPU feature detection. NEON is compiled in only if the target guarantees it e.g. AArch64, hence needs no detection.
+    */
+    std::optional<Data_Kernels> getKernels(pixel::Backend backend) {
+        #if defined(PIXEL_KERNELS_X86)
+        __builtin_cpu_init();   // Required prior to `__builtin_cpu_supports()` during static initialization
+        #endif
+
+        switch (backend) {
+            #if defined(PIXEL_KERNELS_X86)
+            case pixel::Backend::kAVX2:
+                if (__builtin_cpu_supports("avx2")) return Data_Kernels{ backend, avx2::grayscale, avx2::tint, avx2::premultiplyAlpha, avx2::colorKey };
+                break;
+            case pixel::Backend::kSSE2:
+                if (__builtin_cpu_supports("sse2")) return Data_Kernels{ backend, sse2::grayscale, sse2::tint, sse2::premultiplyAlpha, sse2::colorKey };
+                break;
+            #elif defined(PIXEL_KERNELS_NEON)
+            case pixel::Backend::kNEON:
+                return Data_Kernels{ backend, neon::grayscale, neon::tint, neon::premultiplyAlpha, neon::colorKey };
+            #endif
+            case pixel::Backend::kScalar:
+                return Data_Kernels{ backend, scalar::grayscale, scalar::tint, scalar::premultiplyAlpha, scalar::colorKey };
+            default: break;
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * @return The kernels of the fastest backend supported by the CPU.
+    */
+    Data_Kernels selectKernels() {
+        for (auto backend : { pixel::Backend::kAVX2, pixel::Backend::kSSE2, pixel::Backend::kNEON }) {
+            if (auto kernels = getKernels(backend); kernels.has_value()) return kernels.value();
+        }
+        return getKernels(pixel::Backend::kScalar).value();
+    }
+
+    Data_Kernels sKernels = selectKernels();
+
+    inline std::uint32_t toKey(SDL_Color const& color) {
+        return static_cast<std::uint32_t>(color.r) << kShiftR | static_cast<std::uint32_t>(color.g) << kShiftG | static_cast<std::uint32_t>(color.b) << kShiftB;
+    }
+
+    /**
+     * @brief Call `kernel` on each row of `surface`, or once if rows are contiguous.
+     * @return `false` if `surface` is not of `SDL_PIXELFORMAT_RGBA32`.
+    */
+    template <typename Kernel>
+    bool forEachRow(SDL_Surface* surface, Kernel&& kernel) {
+        if (surface == nullptr || surface->format->format != SDL_PIXELFORMAT_RGBA32) return false;
+
+        const bool isLocked = SDL_MUSTLOCK(surface) && !SDL_LockSurface(surface);
+        auto row = static_cast<std::uint8_t*>(surface->pixels);
+        const auto width = static_cast<std::size_t>(surface->w);
+
+        if (surface->pitch == static_cast<int>(width * sizeof(std::uint32_t))) kernel(reinterpret_cast<std::uint32_t*>(row), width * surface->h);
+        else for (int y = 0; y < surface->h; ++y, row += surface->pitch) kernel(reinterpret_cast<std::uint32_t*>(row), width);
+
+        if (isLocked) SDL_UnlockSurface(surface);
+        return true;
+    }
+}
+
+
+void pixel::grayscale(std::uint32_t* pixels, std::size_t count, unsigned int intensity) {
+    if (!intensity) return;
+    sKernels.grayscale(pixels, count, intensity > 256 ? 256 : intensity);
+}
+
+void pixel::tint(std::uint32_t* pixels, std::size_t count, SDL_Color const& color) {
+    sKernels.tint(pixels, count, color);
+}
+
+void pixel::premultiplyAlpha(std::uint32_t* pixels, std::size_t count) {
+    sKernels.premultiplyAlpha(pixels, count);
+}
+
+void pixel::colorKey(std::uint32_t* pixels, std::size_t count, SDL_Color const& key) {
+    sKernels.colorKey(pixels, count, toKey(key));
+}
+
+/**
+ * @brief Similar to `grayscale()`, for a single color e.g. a background color filled rather than blitted.
+*/
+SDL_Color pixel::grayscale(SDL_Color const& color, unsigned int intensity) {
+    std::uint32_t value = static_cast<std::uint32_t>(color.r) << kShiftR | static_cast<std::uint32_t>(color.g) << kShiftG | static_cast<std::uint32_t>(color.b) << kShiftB | static_cast<std::uint32_t>(color.a) << kShiftA;
+    if (intensity) scalar::grayscale(&value, 1, intensity > 256 ? 256 : intensity);
+
+    return {
+        static_cast<Uint8>(scalar::channel(value, kShiftR)),
+        static_cast<Uint8>(scalar::channel(value, kShiftG)),
+        static_cast<Uint8>(scalar::channel(value, kShiftB)),
+        static_cast<Uint8>(scalar::channel(value, kShiftA)),
+    };
+}
+
+bool pixel::grayscale(SDL_Surface* surface, unsigned int intensity) {
+    return forEachRow(surface, [&](std::uint32_t* pixels, std::size_t count) { pixel::grayscale(pixels, count, intensity); });
+}
+
+bool pixel::tint(SDL_Surface* surface, SDL_Color const& color) {
+    return forEachRow(surface, [&](std::uint32_t* pixels, std::size_t count) { pixel::tint(pixels, count, color); });
+}
+
+bool pixel::premultiplyAlpha(SDL_Surface* surface) {
+    return forEachRow(surface, [&](std::uint32_t* pixels, std::size_t count) { pixel::premultiplyAlpha(pixels, count); });
+}
+
+bool pixel::colorKey(SDL_Surface* surface, SDL_Color const& key) {
+    return forEachRow(surface, [&](std::uint32_t* pixels, std::size_t count) { pixel::colorKey(pixels, count, key); });
+}
+
+pixel::Backend pixel::getBackend() {
+    return sKernels.backend;
+}
+
+const char* pixel::getBackendName(Backend backend) {
+    switch (backend) {
+        case Backend::kScalar: return "Scalar";
+        case Backend::kSSE2: return "SSE2";
+        case Backend::kAVX2: return "AVX2";
+        case Backend::kNEON: return "NEON";
+        default: return "Unknown";
+    }
+}
+
+/**
+ * @return Every backend supported by the CPU, from the slowest i.e. `Backend::kScalar`, to the one selected at startup.
+*/
+std::vector<pixel::Backend> pixel::getSupportedBackends() {
+    std::vector<Backend> backends;
+    for (auto backend : { Backend::kScalar, Backend::kSSE2, Backend::kAVX2, Backend::kNEON }) if (getKernels(backend).has_value()) backends.push_back(backend);
+    return backends;
+}
+
+/**
+ * @brief Replace the kernels selected at startup with those of `backend`, e.g. to compare backends against each other.
+ * @return `false` if `backend` is not supported by the CPU, in which case the current kernels are retained.
+ * @note Not thread-safe, hence must not be called while kernels might be running on other threads.
+*/
+bool pixel::setBackend(Backend backend) {
+    auto kernels = getKernels(backend); if (!kernels.has_value()) return false;
+    sKernels = kernels.value();
+    return true;
+}
@@ -0,0 +1,201 @@
+#include <render-command-buffer.hpp>
+
+#include <auxiliaries.hpp>
+
+
+/**
+ * @param texture `nullptr` represents the window.
+*/
+void RenderCommandBuffer::setRenderTarget(SDL_Texture* texture) {
+    Data_Command command{ Data_Command::Type::kSetRenderTarget };
+    command.texture = texture;
+    mCommands.push_back(command);
+
+    mRenderTarget = texture;
+}
+
+void RenderCommandBuffer::setRenderDrawColor(SDL_Color const& color) {
+    Data_Command command{ Data_Command::Type::kSetRenderDrawColor };
+    command.color = color;
+    mCommands.push_back(command);
+}
+
+void RenderCommandBuffer::setTextureAlphaMod(SDL_Texture* texture, Uint8 alpha) {
+    if (texture == nullptr) return;
+    flushBatch(texture);
+
+    Data_Command command{ Data_Command::Type::kSetTextureAlphaMod };
+    command.texture = texture;
+    command.color.a = alpha;
+    mCommands.push_back(command);
+}
+
+void RenderCommandBuffer::setTextureColorMod(SDL_Texture* texture, SDL_Color const& color) {
+    if (texture == nullptr) return;
+    flushBatch(texture);
+
+    Data_Command command{ Data_Command::Type::kSetTextureColorMod };
+    command.texture = texture;
+    command.color = color;
+    mCommands.push_back(command);
+}
+
+void RenderCommandBuffer::setTextureBlendMode(SDL_Texture* texture, SDL_BlendMode blendMode) {
+    if (texture == nullptr) return;
+    flushBatch(texture);
+
+    Data_Command command{ Data_Command::Type::kSetTextureBlendMode };
+    command.texture = texture;
+    command.blendMode = blendMode;
+    mCommands.push_back(command);
+}
+
+void RenderCommandBuffer::renderClear() {
+    mCommands.push_back({ Data_Command::Type::kRenderClear });
+}
+
+/**
+ * @param destRect `nullptr` represents the entire render target.
+*/
+void RenderCommandBuffer::renderFillRect(SDL_Rect const* destRect) {
+    Data_Command command{ Data_Command::Type::kRenderFillRect };
+    if (destRect != nullptr) {
+        command.destRect = *destRect;
+        command.hasDestRect = true;
+    }
+    mCommands.push_back(command);
+}
+
+void RenderCommandBuffer::renderCopy(SDL_Texture* texture, SDL_Rect const* srcRect, SDL_Rect const* destRect) {
+    if (texture == nullptr) return;
+
+    Data_Command command{ Data_Command::Type::kRenderCopy };
+    command.texture = texture;
+    if (srcRect != nullptr) {
+        command.srcRect = *srcRect;
+        command.hasSrcRect = true;
+    }
+    if (destRect != nullptr) {
+        command.destRect = *destRect;
+        command.hasDestRect = true;
+    }
+    mCommands.push_back(command);
+}
+
+/**
+ * @brief Replay pending commands against `renderer` in recorded order, then discard them.
+ * @note The render target and draw color recorded last are bound upon returning, hence direct SDL calls may follow.
+*/
+void RenderCommandBuffer::submit(SDL_Renderer* renderer) {
+    if (mCommands.empty()) return;
+
+    // Bound state, as opposed to the state recorded so far
+    SDL_Texture* currTarget = SDL_GetRenderTarget(renderer);
+    SDL_Color currColor;
+    SDL_GetRenderDrawColor(renderer, &currColor.r, &currColor.g, &currColor.b, &currColor.a);
+
+    SDL_Texture* target = currTarget;
+    SDL_Color color = currColor;
+    std::size_t stateChangeCount = 0, appliedStateChangeCount = 0;
+
+    auto bindTarget = [&]() {
+        if (target == currTarget) return;
+        SDL_SetRenderTarget(renderer, target);
+        currTarget = target;
+        ++appliedStateChangeCount;
+        ++sStats.targetSwitchCount;
+    };
+    auto bindColor = [&]() {
+        if (color.r == currColor.r && color.g == currColor.g && color.b == currColor.b && color.a == currColor.a) return;
+        utils::setRendererDrawColor(renderer, color);
+        currColor = color;
+        ++appliedStateChangeCount;
+    };
+
+    for (auto const& command : mCommands) {
+        switch (command.type) {
+            case Data_Command::Type::kSetRenderTarget:
+                ++stateChangeCount;
+                target = command.texture;
+                break;
+
+            case Data_Command::Type::kSetRenderDrawColor:
+                ++stateChangeCount;
+                color = command.color;
+                break;
+
+            case Data_Command::Type::kSetTextureAlphaMod: {
+                ++stateChangeCount;
+                Uint8 alpha;
+                if (!SDL_GetTextureAlphaMod(command.texture, &alpha) && alpha == command.color.a) break;
+                SDL_SetTextureAlphaMod(command.texture, command.color.a);
+                ++appliedStateChangeCount;
+                break;
+            }
+
+            case Data_Command::Type::kSetTextureColorMod: {
+                ++stateChangeCount;
+                SDL_Color mod;
+                if (!SDL_GetTextureColorMod(command.texture, &mod.r, &mod.g, &mod.b) && mod.r == command.color.r && mod.g == command.color.g && mod.b == command.color.b) break;
+                SDL_SetTextureColorMod(command.texture, command.color.r, command.color.g, command.color.b);
+                ++appliedStateChangeCount;
+                break;
+            }
+
+            case Data_Command::Type::kSetTextureBlendMode: {
+                ++stateChangeCount;
+                SDL_BlendMode blendMode;
+                if (!SDL_GetTextureBlendMode(command.texture, &blendMode) && blendMode == command.blendMode) break;
+                SDL_SetTextureBlendMode(command.texture, command.blendMode);
+                ++appliedStateChangeCount;
+                break;
+            }
+
+            case Data_Command::Type::kRenderClear:
+                bindTarget();
+                bindColor();
+                SDL_RenderClear(renderer);
+                break;
+
+            case Data_Command::Type::kRenderFillRect:
+                bindTarget();
+                bindColor();
+                SDL_RenderFillRect(renderer, command.hasDestRect ? &command.destRect : nullptr);
+                break;
+
+            case Data_Command::Type::kRenderCopy:
+                bindTarget();
+                SDL_RenderCopy(renderer, command.texture, command.hasSrcRect ? &command.srcRect : nullptr, command.hasDestRect ? &command.destRect : nullptr);
+                break;
+        }
+    }
+
+    bindTarget();
+    bindColor();
+
+    sStats.commandCount += mCommands.size();
+    sStats.elidedStateChangeCount += stateChangeCount > appliedStateChangeCount ? stateChangeCount - appliedStateChangeCount : 0;
+    mCommands.clear();
+}
+
+/**
+ * @note Recommended implementation: this method should be called once, at the very end of every frame.
+*/
+void RenderCommandBuffer::endFrame() {
+    sPrevStats = sStats;
+    sStats = Data_Stats();
+}
+
+/**
+ * @brief Flush `globals::batch` should any of its pending quads sample `texture`.
+ * @note `SpriteBatch` reads texture modulations upon flush rather than upon `draw()`, hence would otherwise draw quads queued prior to a state change with the new state.
+*/
+void RenderCommandBuffer::flushBatch(SDL_Texture* texture) {
+    if (globals::batch.contains(texture)) globals::batch.flush(globals::renderer);
+}
+
+
+RenderCommandBuffer::Data_Stats RenderCommandBuffer::sStats;
+RenderCommandBuffer::Data_Stats RenderCommandBuffer::sPrevStats;
+
+RenderCommandBuffer globals::renderCommands;
@@ -0,0 +1,86 @@
+#include <render-queue.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <auxiliaries.hpp>
+
+
+/**
+ * @param layer takes precedence over `depth`. Clamped to `[0, 2^kLayerBits)`.
+ * @param depth sprites with greater depths are drawn on top. Clamped to `[-2^(kDepthBits - 1), 2^(kDepthBits - 1))`.
+*/
+void RenderQueue::submit(SpriteBatch::Data_Quad const& quad, unsigned int layer, int depth) {
+    if (quad.texture == nullptr) return;
+
+    constexpr int kDepthBias = 1 << (kDepthBits - 1);
+    const Key layerKey = std::min<Key>(layer, (1u << kLayerBits) - 1);
+    const Key depthKey = static_cast<Key>(std::clamp(depth + kDepthBias, 0, (1 << kDepthBits) - 1));
+
+    mEntries.push_back({ layerKey << (kDepthBits + kTextureBits) | depthKey << kTextureBits | getTextureKey(quad.texture), static_cast<std::uint32_t>(mQuads.size()) });
+    mQuads.push_back(quad);
+}
+
+/**
+ * @brief Sort pending sprites, then forward them to `batch` under `batchLayer`.
+ * @note Does not flush `batch` itself.
+*/
+void RenderQueue::flush(SpriteBatch& batch, int batchLayer) {
+    if (mEntries.empty()) return;
+
+    sort();
+    for (auto const& entry : mEntries) batch.draw(mQuads[entry.index], batchLayer);
+
+    clear();
+}
+
+/**
+ * @brief Discard pending sprites.
+*/
+void RenderQueue::clear() {
+    mQuads.clear();
+    mEntries.clear();
+    mTextureKeys.clear();
+}
+
+/**
+ * @note Textures beyond `2^kTextureBits` per frame share keys, which merely weakens grouping.
+*/
+RenderQueue::Key RenderQueue::getTextureKey(SDL_Texture* texture) {
+    auto [it, isInserted] = mTextureKeys.try_emplace(texture, static_cast<Key>(mTextureKeys.size()));
+    return it->second & ((1u << kTextureBits) - 1);
+}
+
+/**
+ * @brief Sort `mEntries` by key, stably, in `kPassCount` counting passes of `kDigitBits` bits each.
+ * @note Histograms of every digit are gathered in a single sweep. Passes whose digit is shared by all keys are skipped, e.g. the layer digit when every sprite is on the same layer.
+*/
+void RenderQueue::sort() {
+    const std::size_t count = mEntries.size();
+    if (count < 2) return;
+
+    std::array<std::array<std::size_t, kRadix>, kPassCount> histograms{};
+    for (auto const& entry : mEntries) for (unsigned int pass = 0; pass < kPassCount; ++pass) ++histograms[pass][entry.key >> (pass * kDigitBits) & (kRadix - 1)];
+
+    mScratch.resize(count);
+
+    for (unsigned int pass = 0; pass < kPassCount; ++pass) {
+        auto& histogram = histograms[pass];
+        const unsigned int shift = pass * kDigitBits;
+        if (histogram[mEntries.front().key >> shift & (kRadix - 1)] == count) continue;   // Already sorted by this digit
+
+        // Exclusive prefix sums i.e. the first output position of each bucket
+        std::size_t offset = 0;
+        for (auto& bucket : histogram) {
+            auto size = bucket;
+            bucket = offset;
+            offset += size;
+        }
+
+        for (auto const& entry : mEntries) mScratch[histogram[entry.key >> shift & (kRadix - 1)]++] = entry;
+        mEntries.swap(mScratch);
+    }
+}
+
+
+RenderQueue globals::renderQueue;
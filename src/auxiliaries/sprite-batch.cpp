@@ -0,0 +1,161 @@
+#include <sprite-batch.hpp>
+
+#include <cmath>
+#include <utility>
+
+#include <auxiliaries.hpp>
+
+
+/**
+ * @brief Queue `quad` into `layer`.
+*/
+void SpriteBatch::draw(Data_Quad const& quad, int layer) {
+    if (quad.texture == nullptr || quad.destRect.w <= 0 || quad.destRect.h <= 0) return;
+
+    mLayers[layer].push_back(quad);
+    ++mPendingCount;
+}
+
+/**
+ * @brief Submit every pending quad to the current render target of `renderer`.
+ * @note Commands pending in `globals::renderCommands` are submitted beforehand, since they were recorded first and determine the render target.
+*/
+void SpriteBatch::flush(SDL_Renderer* renderer) {
+    globals::renderCommands.submit(renderer);
+    if (!mPendingCount) return;
+
+    for (auto& [layer, quads] : mLayers) {
+        std::size_t begin = 0;
+        for (std::size_t end = 1; end <= quads.size(); ++end) {
+            if (end != quads.size() && quads[end].texture == quads[begin].texture) continue;
+            submit(renderer, quads, begin, end);
+            begin = end;
+        }
+        quads.clear();
+    }
+
+    sStats.quadCount += mPendingCount;
+    mPendingCount = 0;
+}
+
+/**
+ * @brief Discard pending quads.
+*/
+void SpriteBatch::clear() {
+    for (auto& [layer, quads] : mLayers) quads.clear();
+    mPendingCount = 0;
+}
+
+/**
+ * @return Whether any pending quad samples `texture`.
+ * @note Costs `O(n)` over pending quads, hence should be reserved for infrequent checks e.g. prior to altering the state of `texture`.
+*/
+bool SpriteBatch::contains(SDL_Texture* texture) const {
+    if (!mPendingCount) return false;
+
+    for (auto const& [layer, quads] : mLayers) {
+        for (auto const& quad : quads) if (quad.texture == texture) return true;
+    }
+    return false;
+}
+
+/**
+ * @note Recommended implementation: this method should be called once, at the very end of every frame.
+*/
+void SpriteBatch::endFrame() {
+    sPrevStats = sStats;
+    sStats = Data_Stats();
+}
+
+/**
+ * @brief Submit `quads[begin, end)`, which share the same texture, in one `SDL_RenderGeometry()` call.
+*/
+void SpriteBatch::submit(SDL_Renderer* renderer, std::vector<Data_Quad> const& quads, std::size_t begin, std::size_t end) {
+    #if SDL_VERSION_ATLEAST(2, 0, 18)
+    auto texture = quads[begin].texture;
+
+    SDL_Point textureSize;
+    SDL_Color color;
+    SDL_QueryTexture(texture, nullptr, nullptr, &textureSize.x, &textureSize.y);
+    SDL_GetTextureColorMod(texture, &color.r, &color.g, &color.b);
+    SDL_GetTextureAlphaMod(texture, &color.a);
+
+    mVertices.clear();
+    mIndices.clear();
+
+    for (auto index = begin; index < end; ++index) {
+        auto const& quad = quads[index];
+
+        float u0 = static_cast<float>(quad.srcRect.x) / textureSize.x;
+        float v0 = static_cast<float>(quad.srcRect.y) / textureSize.y;
+        float u1 = static_cast<float>(quad.srcRect.x + quad.srcRect.w) / textureSize.x;
+        float v1 = static_cast<float>(quad.srcRect.y + quad.srcRect.h) / textureSize.y;
+        if (quad.flip & SDL_FLIP_HORIZONTAL) std::swap(u0, u1);
+        if (quad.flip & SDL_FLIP_VERTICAL) std::swap(v0, v1);
+
+        // Corners relative to the pivot, in clockwise order starting from the top-left
+        const SDL_FPoint pivot = quad.hasCenter ? SDL_FPoint{ static_cast<float>(quad.center.x), static_cast<float>(quad.center.y) } : SDL_FPoint{ quad.destRect.w / 2.0f, quad.destRect.h / 2.0f };
+        const SDL_FPoint center = { quad.destRect.x + pivot.x, quad.destRect.y + pivot.y };
+        const float left = -pivot.x, top = -pivot.y, right = quad.destRect.w - pivot.x, bottom = quad.destRect.h - pivot.y;
+        SDL_FPoint corners[4] = { { left, top }, { right, top }, { right, bottom }, { left, bottom } };
+        const SDL_FPoint texCoords[4] = { { u0, v0 }, { u1, v0 }, { u1, v1 }, { u0, v1 } };
+
+        if (quad.angle != 0) {
+            const float rad = static_cast<float>(quad.angle * M_PI / 180);
+            const float cos = std::cos(rad), sin = std::sin(rad);
+            for (auto& corner : corners) corner = { corner.x * cos - corner.y * sin, corner.x * sin + corner.y * cos };   // Clockwise, since the y-axis points downwards
+        }
+
+        const SDL_Color quadColor = {
+            static_cast<Uint8>(color.r * quad.color.r / 0xff),
+            static_cast<Uint8>(color.g * quad.color.g / 0xff),
+            static_cast<Uint8>(color.b * quad.color.b / 0xff),
+            static_cast<Uint8>(color.a * quad.color.a / 0xff),
+        };
+
+        const int offset = static_cast<int>(mVertices.size());
+        for (int corner = 0; corner < 4; ++corner) mVertices.push_back({ { center.x + corners[corner].x, center.y + corners[corner].y }, quadColor, texCoords[corner] });
+        for (int vertex : { 0, 1, 2, 0, 2, 3 }) mIndices.push_back(offset + vertex);
+    }
+
+    if (SDL_RenderGeometry(renderer, texture, mVertices.data(), static_cast<int>(mVertices.size()), mIndices.data(), static_cast<int>(mIndices.size())) == 0) {
+        ++sStats.drawCallCount;
+        return;
+    }
+    #endif
+
+    submitFallback(renderer, quads, begin, end);
+}
+
+/**
+ * @note The color of each quad is applied by temporarily altering the modulation of its texture.
+*/
+void SpriteBatch::submitFallback(SDL_Renderer* renderer, std::vector<Data_Quad> const& quads, std::size_t begin, std::size_t end) {
+    SDL_Color color;
+    SDL_GetTextureColorMod(quads[begin].texture, &color.r, &color.g, &color.b);
+    SDL_GetTextureAlphaMod(quads[begin].texture, &color.a);
+
+    for (auto index = begin; index < end; ++index) {
+        auto const& quad = quads[index];
+        const bool isTinted = quad.color.r != 0xff || quad.color.g != 0xff || quad.color.b != 0xff || quad.color.a != SDL_ALPHA_OPAQUE;
+
+        if (isTinted) {
+            SDL_SetTextureColorMod(quad.texture, color.r * quad.color.r / 0xff, color.g * quad.color.g / 0xff, color.b * quad.color.b / 0xff);
+            SDL_SetTextureAlphaMod(quad.texture, color.a * quad.color.a / 0xff);
+        }
+
+        SDL_RenderCopyEx(renderer, quad.texture, &quad.srcRect, &quad.destRect, quad.angle, quad.hasCenter ? &quad.center : nullptr, quad.flip);
+
+        if (isTinted) {
+            SDL_SetTextureColorMod(quad.texture, color.r, color.g, color.b);
+            SDL_SetTextureAlphaMod(quad.texture, color.a);
+        }
+    }
+    sStats.drawCallCount += end - begin;
+}
+
+
+SpriteBatch::Data_Stats SpriteBatch::sStats;
+SpriteBatch::Data_Stats SpriteBatch::sPrevStats;
+
+SpriteBatch globals::batch;
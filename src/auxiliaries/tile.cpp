@@ -1,11 +1,17 @@
 #include <auxiliaries.hpp>
 
 #include <algorithm>
+#include <cstdlib>
+#include <future>
+#include <memory>
 #include <optional>
 #include <filesystem>
+#include <sstream>
 
 #include <SDL.h>
 
+#include <pixel-kernels.hpp>
+
 
 std::string tile::Data_Generic::getProperty(std::string const& key) {
     auto it = properties.find(key);
@@ -20,10 +26,10 @@ void tile::Data_Generic::setProperty(std::string const& key, std::string const&
 
 /**
  * @brief Read data associated with a tileset from loaded XML data.
- * @note Also loads the `texture`.
+ * @note Also loads the `texture`, unless `renderer` is `nullptr`.
  * @note Requires `document` to be successfully loaded from a XML file.
 */
-void tile::Data_Generic::load(pugi::xml_document const& XMLTilesetData, SDL_Renderer* renderer) {
+void tile::Data_Generic::load(pugi::xml_document const& XMLTilesetData, SDL_Renderer* renderer, Data_Atlas::Pool pool) {
     // Parse nodes
     auto tileset_n = XMLTilesetData.child("tileset"); if (tileset_n.empty()) return;
     auto image_n = tileset_n.child("image"); if (image_n.empty()) return;
@@ -44,25 +50,53 @@ void tile::Data_Generic::load(pugi::xml_document const& XMLTilesetData, SDL_Rend
     };
 
     // Texture
-    auto source_a = image_n.attribute("source"); if (source_a == nullptr) return;
+    if (renderer == nullptr) return;
+    auto path = getImagePath(XMLTilesetData); if (!path.has_value()) return;
+    auto surface = IMG_Load(path.value().string().c_str()); if (surface == nullptr) return;   // Should also check whether path exists
+    loadTexture(surface, renderer, pool);
+    SDL_FreeSurface(surface);
+}
 
-    std::filesystem::path path(source_a.as_string());
-    texture = IMG_LoadTexture(renderer, (config::path::asset / utils::cleanRelativePath(path)).string().c_str());   // Should also check whether path exists
+/**
+ * @brief Pack `surface` into the `pool` pages of `tile::atlas`, then point `texture` and `srcOrigin` to the packed image.
+ * @note Does not take ownership of `surface`. Must be performed on the thread that owns `renderer`.
+*/
+void tile::Data_Generic::loadTexture(SDL_Surface* surface, SDL_Renderer* renderer, Data_Atlas::Pool pool) {
+    clear();
+
+    auto region = atlas.insert(surface, renderer, pool);
+    texture = region.texture;
+    srcOrigin = region.origin;
+    atlasPage = region.page;
 }
 
 void tile::Data_Generic::clear() {
     if (texture != nullptr) {
-        SDL_DestroyTexture(texture);
+        atlas.release({ texture, srcOrigin, atlasPage });
         texture = nullptr;
     }
+
+    srcOrigin = { 0, 0 };
+    atlasPage = -1;
+}
+
+/**
+ * @return The path to the image associated with the tileset, relative to the working directory.
+*/
+std::optional<std::filesystem::path> tile::Data_Generic::getImagePath(pugi::xml_document const& XMLTilesetData) {
+    auto source_a = XMLTilesetData.child("tileset").child("image").attribute("source"); if (source_a == nullptr) return std::nullopt;
+
+    std::filesystem::path path(source_a.as_string());
+    return config::path::asset / utils::cleanRelativePath(path);
 }
 
 /**
  * @brief Read data associated with a tilelayer tileset from loaded JSON data.
  * @note Also loads the `texture` and populate `firstGID`.
+ * @param animations if provided, receives the animated tiles of the tileset, keyed by GID. Single-frame animations are ignored.
  * @note `firstGID` is contained only in Tiled Map JSON files.
 */
-void tile::Data_TilelayerTileset::load(json const& JSONTileLayerData, SDL_Renderer* renderer) {
+void tile::Data_TilelayerTileset::load(json const& JSONTileLayerData, SDL_Renderer* renderer, AnimationMap* animations) {
     auto firstGID_j = JSONTileLayerData.find("firstgid"); if (firstGID_j == JSONTileLayerData.end()) return;
     auto firstGID_v = firstGID_j.value(); if (!firstGID_v.is_number_integer()) return;
     firstGID = firstGID_j.value();
@@ -76,9 +110,27 @@ void tile::Data_TilelayerTileset::load(json const& JSONTileLayerData, SDL_Render
     if (!result) return;   // Should be replaced with `result.status` or `pugi::xml_parse_status`
 
     Data_Generic::load(document, renderer);
+    imagePath = getImagePath(document).value_or(std::filesystem::path());
+    auto tileset_n = document.child("tileset");
+
+    // Animated tiles
+    if (animations != nullptr) for (auto tile_n = tileset_n.child("tile"); tile_n; tile_n = tile_n.next_sibling("tile")) {
+        auto animation_n = tile_n.child("animation"); if (animation_n.empty()) continue;
+        auto id_a = tile_n.attribute("id"); if (id_a == nullptr) continue;
+
+        Data_TileAnimation animation;
+        for (auto frame_n = animation_n.child("frame"); frame_n; frame_n = frame_n.next_sibling("frame")) {
+            auto tileID_a = frame_n.attribute("tileid"); if (tileID_a == nullptr) continue;
+            auto duration_a = frame_n.attribute("duration"); if (duration_a == nullptr || !duration_a.as_uint()) continue;
+
+            animation.frames.push_back({ firstGID + tileID_a.as_int(), duration_a.as_uint() });
+            animation.duration += duration_a.as_uint();
+        }
+
+        if (animation.frames.size() > 1) animations->insert_or_assign(firstGID + id_a.as_int(), std::move(animation));
+    }
 
     // Properties
-    auto tileset_n = document.child("tileset");
     auto properties_n = tileset_n.child("properties"); if (properties_n.empty()) return;
 
     for (auto property_n = properties_n.child("property"); property_n; property_n = property_n.next_sibling("property")) {
@@ -95,35 +147,98 @@ void tile::Data_TilelayerTileset::load(json const& JSONTileLayerData, SDL_Render
     }
 }
 
+/**
+ * @return The GID to be displayed at `ticks` milliseconds.
+*/
+tile::GID tile::Data_TileAnimation::getFrame(unsigned int ticks) const {
+    if (frames.empty()) return 0;
+    if (!duration) return frames.front().gid;
+
+    ticks %= duration;
+    for (auto const& frame : frames) {
+        if (ticks < frame.duration) return frame.gid;
+        ticks -= frame.duration;
+    }
+
+    return frames.back().gid;
+}
+
+/**
+ * @brief Pack a grayscaled copy of the image into `tile::atlas`, if not already packed.
+ * @param intensity in `[0, 256]`, where `256` yields pure grayscale.
+ * @note The image is reloaded from `imagePath` and converted on the CPU before upload, hence requires no readback from the GPU.
+ * @return `false` if the image could not be loaded.
+*/
+bool tile::Data_TilelayerTileset::loadGrayscale(SDL_Renderer* renderer, unsigned int intensity) {
+    if (grayscale.texture != nullptr) return true;
+    if (renderer == nullptr || imagePath.empty()) return false;
+
+    auto surface = IMG_Load(imagePath.string().c_str()); if (surface == nullptr) return false;
+    auto converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);   // `pixel` kernels operate on this format only
+    SDL_FreeSurface(surface);
+    if (converted == nullptr) return false;
+
+    pixel::grayscale(converted, intensity);
+    grayscale = atlas.insert(converted, renderer);
+    SDL_FreeSurface(converted);
+
+    return grayscale.texture != nullptr;
+}
+
+void tile::Data_TilelayerTileset::clear() {
+    if (grayscale.texture != nullptr) atlas.release(grayscale);
+    grayscale = Data_Atlas::Data_Region();
+
+    Data_Generic::clear();
+}
+
 void tile::Data_TilelayerTilesets::load(json const& JSONLevelData, SDL_Renderer* renderer) {
     for (auto& tilelayer : mData) tilelayer.clear();   // Necessary?
     mData.clear();
+    mAnimations.clear();
+    mIsGrayscaleLoaded.reset();
 
     auto tilesets_j = JSONLevelData.find("tilesets"); if (tilesets_j == JSONLevelData.end()) return;
     auto tilesets_v = tilesets_j.value(); if (!tilesets_v.is_array()) return;
 
     for (const auto& tileset : tilesets_v) {
         tile::Data_TilelayerTileset tilelayer;
-        tilelayer.load(tileset, renderer);
+        tilelayer.load(tileset, renderer, &mAnimations);
         mData.emplace_back(tilelayer);
     }
 }
 
+/**
+ * @brief Call `Data_TilelayerTileset::loadGrayscale()` on every tileset. Deferred until a grayscaled variant of the level is actually requested.
+ * @note Only the first call since `load()` does any work; its result is retained.
+*/
+bool tile::Data_TilelayerTilesets::loadGrayscale(SDL_Renderer* renderer, unsigned int intensity) {
+    if (mIsGrayscaleLoaded.has_value()) return mIsGrayscaleLoaded.value();
+
+    bool isLoaded = true;
+    for (auto& tilelayer : mData) if (tilelayer.texture != nullptr) isLoaded &= tilelayer.loadGrayscale(renderer, intensity);
+
+    mIsGrayscaleLoaded = isLoaded;
+    return isLoaded;
+}
+
 std::optional<tile::Data_TilelayerTileset> tile::Data_TilelayerTilesets::operator[](GID gid) const {
-    // auto it = std::find_if(mData.begin(), mData.end(), [&](const auto& tilelayer) {
-    //     return tilelayer.firstGID <= gid && gid < tilelayer.firstGID + tilelayer.srcCount.x * tilelayer.srcCount.y;
-    // });
-    // return it != mData.end() ? std::optional<Data_TilelayerTileset>(*it) : std::nullopt;
+    auto tilelayer = find(gid);
+    return tilelayer != nullptr ? std::make_optional<Data_TilelayerTileset>(*tilelayer) : std::nullopt;
+}
 
+/**
+ * @return The tileset `gid` belongs to, without copying it, or `nullptr` if there is none.
+ * @note The pointer is invalidated by the next `load()` call.
+*/
+tile::Data_TilelayerTileset const* tile::Data_TilelayerTilesets::find(GID gid) const {
     auto it = std::lower_bound(mData.begin(), mData.end(), gid, [](const Data_TilelayerTileset& tilelayer, GID gid) {
         return tilelayer.firstGID + tilelayer.srcCount.x * tilelayer.srcCount.y <= gid;   // First `tilelayer` whose `firstGID` is not less than `gid`
     });   // Use `std::lower_bound` (O(log n)) in lieu of `std::find_if` (O(n)) since `mData` is sorted by `firstGID`
 
     if (it != mData.begin() && (it == mData.end() || it->firstGID > gid)) --it;   // Adjust flaw-susceptible search result so that condition `tilelayer.firstGID <= gid` is met
 
-    // if (it != mData.end() && it->firstGID <= gid && gid < it->firstGID + it->srcCount.x * it->srcCount.y) return std::optional<Data_TilelayerTileset>(*it);
-    // else return std::nullopt;
-    return it != mData.end() ? std::make_optional<Data_TilelayerTileset>(*it) : std::nullopt;
+    return it != mData.end() ? &*it : nullptr;
 }
 
 /**
@@ -201,6 +316,16 @@ void tile::Data_EntityTileset::Data_Animation::load(pugi::xml_node const& XMLAni
             case hstr("ticks-multiplier"):
                 ticksMultiplier = value_a.as_double();
                 break;
+            case hstr("event-frames"): {
+                std::uint32_t mask = 0;
+                std::stringstream stream(value_a.as_string());
+                for (std::string repr; std::getline(stream, repr, ',');) {
+                    auto index = std::strtoul(repr.c_str(), nullptr, 10);
+                    if (index < 32) mask |= 1u << index;
+                }
+                eventFrames = mask;
+                break;
+            }
             default: break;
         }
     }
@@ -208,11 +333,26 @@ void tile::Data_EntityTileset::Data_Animation::load(pugi::xml_node const& XMLAni
 
 /**
  * @brief Read data associated with a tileset used for an entity or an animated object from loaded XML data.
- * @note Use `std::strcmp()` instead of `std::string()` in C-string comparison for slight performance gains.
+ * @note The image is packed into the entity pool, since it may outlive the level.
 */
 void tile::Data_EntityTileset::load(pugi::xml_document const& XMLTilesetData, SDL_Renderer* renderer) {
-    Data_Generic::load(XMLTilesetData, renderer);
+    Data_Generic::load(XMLTilesetData, renderer, Data_Atlas::Pool::kEntity);
+    loadProperties(XMLTilesetData);
+    compileAnimations();
+}
 
+/**
+ * @brief Similar to `Data_Generic::loadTexture()`, but also recompiles animations, whose source rects depend on `srcOrigin`.
+*/
+void tile::Data_EntityTileset::loadTexture(SDL_Surface* surface, SDL_Renderer* renderer) {
+    Data_Generic::loadTexture(surface, renderer, Data_Atlas::Pool::kEntity);
+    compileAnimations();
+}
+
+/**
+ * @note Use `std::strcmp()` instead of `std::string()` in C-string comparison for slight performance gains.
+*/
+void tile::Data_EntityTileset::loadProperties(pugi::xml_document const& XMLTilesetData) {
     auto tileset_n = XMLTilesetData.child("tileset"); if (tileset_n.empty()) return;
     auto properties_n = tileset_n.child("properties"); if (properties_n.empty()) return;
 
@@ -248,24 +388,384 @@ void tile::Data_EntityTileset::load(pugi::xml_document const& XMLTilesetData, SD
 
             auto pair = stoan(name_a.as_string()); if (!pair.first.has_value()) continue;   // Note that `isMultidirectional` is not correctly defined at the point of parsing
 
-            Data_Animation data;
-            data.load(animations_n);
+            auto animationIndex = getAnimationIndex(pair.first.value());
+            auto directionIndex = getDirectionIndex(pair.second.value_or(kDefaultDirection));
+            if (animationIndex == kAnimationCount || directionIndex == kDirectionCount) continue;
+
+            mAnimations[animationIndex * kDirectionCount + directionIndex].load(animations_n);
+        }
+    }
+}
+
+/**
+ * @brief Expand every animation into its sequence of frames, each with a precomputed `srcRect` and duration.
+ * @note Unregistered animations are compiled as if spanning `GID` `0` only, same as their default `Data_Animation`.
+*/
+void tile::Data_EntityTileset::compileAnimations() {
+    mFrames.clear();
+    if (srcCount.x <= 0 || srcCount.y <= 0 || animationSize.x <= 0 || animationSize.y <= 0) return;
+
+    auto maxFrameCount = static_cast<std::size_t>(srcCount.x * srcCount.y);   // Guard against malformed `stopGID`
+    SDL_Point frameSize = { srcSize.x * animationSize.x, srcSize.y * animationSize.y };
+
+    static constexpr std::array<Animation, kAnimationCount> animations = { Animation::kIdle, Animation::kWalk, Animation::kRun, Animation::kAttackMeele, Animation::kAttackRanged, Animation::kDamaged, Animation::kDeath };   // Ordered by `getAnimationIndex()`
+
+    for (std::size_t i = 0; i < mAnimations.size(); ++i) {
+        auto& animation = mAnimations[i];
+        animation.frameOffset = mFrames.size();
+        auto ticks = static_cast<unsigned int>(animationTicks * animation.ticksMultiplier);
 
-            mUMap.insert(std::make_pair(std::make_pair(pair.first.value(), pair.second.value_or(kDefaultDirection)), data));
+        for (int GID = animation.startGID;;) {
+            mFrames.push_back({ { srcOrigin.x + GID % srcCount.x * srcSize.x, srcOrigin.y + GID / srcCount.x * srcSize.y, frameSize.x, frameSize.y }, ticks, Event::kNone });
+            if (GID >= animation.stopGID || mFrames.size() - animation.frameOffset >= maxFrameCount) break;
+
+            GID += animationSize.x;
+            if (GID / srcCount.x != (GID - animationSize.x) / srcCount.x) GID += srcCount.x * (animationSize.y - 1);   // Originally intended for "flawed" tilesets where `animationSize.x` > `srcCount.x`
         }
+
+        animation.frameCount = mFrames.size() - animation.frameOffset;
+
+        // Tag frames with the associated event
+        auto event = getEvent(animations[i / kDirectionCount]); if (event == Event::kNone) continue;
+        auto eventFrames = animation.eventFrames.value_or(getContinuity(animations[i / kDirectionCount]) ? 1u | 1u << (animation.frameCount >> 1) : 1u);
+        for (unsigned int index = 0; index < animation.frameCount && index < 32; ++index) if (eventFrames >> index & 1u) mFrames[animation.frameOffset + index].event = event;
     }
 }
 
+/**
+ * @return The frame of `animation` displayed at `ticks`, assuming the animation loops since tick `0`, or `nullptr` if `animation` has no frames.
+*/
+tile::Data_EntityTileset::Data_Frame const* tile::Data_EntityTileset::getFrameAtPhase(Data_Animation const& animation, unsigned int ticks) const {
+    if (!animation.frameCount) return nullptr;
+
+    unsigned int cycleTicks = 0;
+    for (unsigned int index = 0; index < animation.frameCount; ++index) cycleTicks += mFrames[animation.frameOffset + index].ticks;
+    if (!cycleTicks) return &mFrames[animation.frameOffset];
+
+    ticks %= cycleTicks;
+    for (unsigned int index = 0; index < animation.frameCount; ++index) {
+        auto const& frame = mFrames[animation.frameOffset + index];
+        if (ticks < frame.ticks) return &frame;
+        ticks -= frame.ticks;
+    }
+    return &mFrames[animation.frameOffset + animation.frameCount - 1];
+}
+
 tile::Data_EntityTileset::Data_Animation const& tile::Data_EntityTileset::at(Animation animation, SDL_Point const& direction) const {
     static Data_Animation nullopt_repr{};
-    auto it = mUMap.find(std::make_pair(animation, direction));
-    return it != mUMap.end() ? it->second : nullopt_repr;    
+
+    auto animationIndex = getAnimationIndex(animation);
+    auto directionIndex = getDirectionIndex(direction);
+    if (animationIndex == kAnimationCount || directionIndex == kDirectionCount) return nullopt_repr;
+
+    return mAnimations[animationIndex * kDirectionCount + directionIndex];
 }
 
-std::size_t tile::Data_EntityTileset::hash::operator()(std::pair<Animation, SDL_Point> const& instance) const {
-    return std::hash<char>{}(static_cast<char>(instance.first)) ^ std::hash<SDL_Point>{}(instance.second);
+
+/**
+ * @brief Pack `surface` into the first page of `pool` with enough room, creating a new page if none has.
+ * @return The region the image is packed into, or a standalone texture should the image not fit into an empty page.
+*/
+tile::Data_Atlas::Data_Region tile::Data_Atlas::insert(SDL_Surface* surface, SDL_Renderer* renderer, Pool pool) {
+    Data_Region region;
+    if (surface == nullptr || renderer == nullptr) return region;
+
+    if (!mPageSize.x || !mPageSize.y) {
+        SDL_RendererInfo info;
+        mPageSize = { config::atlas::pageSize, config::atlas::pageSize };
+        if (!SDL_GetRendererInfo(renderer, &info)) {
+            if (info.max_texture_width) mPageSize.x = std::min(mPageSize.x, info.max_texture_width);
+            if (info.max_texture_height) mPageSize.y = std::min(mPageSize.y, info.max_texture_height);
+        }
+    }
+
+    SDL_Point size = { surface->w + config::atlas::padding * 2, surface->h + config::atlas::padding * 2 };
+    auto converted = size.x <= mPageSize.x && size.y <= mPageSize.y ? SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0) : nullptr;
+
+    if (converted == nullptr) {
+        region.texture = SDL_CreateTextureFromSurface(renderer, surface);
+        if (region.texture != nullptr) ++mStandaloneCount;
+        return region;
+    }
+
+    // Find a page with enough room, preferably an existing one
+    std::optional<std::pair<std::size_t, SDL_Point>> position;
+    int page = 0;
+    for (; page < static_cast<int>(mPages.size()); ++page) {
+        if (mPages[page].texture == nullptr || mPages[page].pool != pool) continue;
+        if ((position = fit(mPages[page], size)).has_value()) break;
+    }
+    if (!position.has_value()) {
+        page = createPage(renderer, pool);
+        if (page >= 0) position = fit(mPages[page], size);
+    }
+
+    if (!position.has_value()) {
+        SDL_FreeSurface(converted);
+        region.texture = SDL_CreateTextureFromSurface(renderer, surface);
+        if (region.texture != nullptr) ++mStandaloneCount;
+        return region;
+    }
+
+    // Extrude edges into the padding
+    std::vector<Uint32> pixels(static_cast<std::size_t>(size.x) * size.y);
+    SDL_LockSurface(converted);
+    for (int y = 0; y < size.y; ++y) {
+        auto row = reinterpret_cast<Uint32 const*>(static_cast<Uint8 const*>(converted->pixels) + std::clamp(y - config::atlas::padding, 0, surface->h - 1) * converted->pitch);
+        for (int x = 0; x < size.x; ++x) pixels[y * size.x + x] = row[std::clamp(x - config::atlas::padding, 0, surface->w - 1)];
+    }
+    SDL_UnlockSurface(converted);
+    SDL_FreeSurface(converted);
+
+    SDL_Rect rect = { position->second.x, position->second.y, size.x, size.y };
+    SDL_UpdateTexture(mPages[page].texture, &rect, pixels.data(), size.x * static_cast<int>(sizeof(Uint32)));
+    place(mPages[page], position->first, rect);
+
+    region.texture = mPages[page].texture;
+    region.origin = { rect.x + config::atlas::padding, rect.y + config::atlas::padding };
+    region.page = page;
+    return region;
+}
+
+/**
+ * @brief Release an image previously returned by `insert()`. Pages with no images left are destroyed.
+*/
+void tile::Data_Atlas::release(Data_Region const& region) {
+    if (region.page < 0) {
+        if (region.texture != nullptr) SDL_DestroyTexture(region.texture);
+        if (mStandaloneCount) --mStandaloneCount;
+        return;
+    }
+
+    if (region.page >= static_cast<int>(mPages.size())) return;   // Already cleared
+    auto& page = mPages[region.page];
+    if (page.texture != region.texture || !page.imageCount || --page.imageCount) return;
+
+    SDL_DestroyTexture(page.texture);
+    page = Data_Page{};
+}
+
+/**
+ * @note Standalone textures are not tracked, hence are left to their owners.
+*/
+void tile::Data_Atlas::clear() {
+    for (auto& page : mPages) if (page.texture != nullptr) SDL_DestroyTexture(page.texture);
+    mPages.clear();
+    mPageSize = { 0, 0 };
+}
+
+tile::Data_Atlas::Data_Stats tile::Data_Atlas::getStats() const {
+    Data_Stats stats;
+    for (auto const& page : mPages) {
+        if (page.texture == nullptr) continue;
+        ++stats.pageCount;
+        stats.imageCount += page.imageCount;
+        stats.usedArea += page.usedArea;
+    }
+
+    stats.totalArea = stats.pageCount * mPageSize.x * mPageSize.y;
+    stats.imageCount += mStandaloneCount;
+    stats.textureCount = stats.pageCount + mStandaloneCount;
+    return stats;
+}
+
+/**
+ * @brief Find the lowest, then leftmost position on the skyline of `page` that fits `size`.
+ * @return The index of the skyline node the position starts at, and the position itself.
+*/
+std::optional<std::pair<std::size_t, SDL_Point>> tile::Data_Atlas::fit(Data_Page const& page, SDL_Point const& size) const {
+    std::optional<std::pair<std::size_t, SDL_Point>> result;
+    int bestWidth = 0;
+
+    for (std::size_t index = 0; index < page.skyline.size(); ++index) {
+        int x = page.skyline[index].x;
+        if (x + size.x > mPageSize.x) break;   // Nodes are sorted by `x`
+
+        int y = 0;
+        for (std::size_t i = index, width = 0; width < static_cast<std::size_t>(size.x); width += page.skyline[i++].w) y = std::max(y, page.skyline[i].y);
+        if (y + size.y > mPageSize.y) continue;
+
+        if (!result.has_value() || y < result->second.y || (y == result->second.y && page.skyline[index].w < bestWidth)) {
+            result = std::make_pair(index, SDL_Point{ x, y });
+            bestWidth = page.skyline[index].w;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Raise the skyline of `page` over `rect`, previously returned by `fit()`.
+*/
+void tile::Data_Atlas::place(Data_Page& page, std::size_t index, SDL_Rect const& rect) {
+    auto& skyline = page.skyline;
+    skyline.insert(skyline.begin() + index, { rect.x, rect.y + rect.h, rect.w });
+
+    // Shrink or remove nodes now covered by the new one
+    for (auto i = index + 1; i < skyline.size();) {
+        int overlap = skyline[index].x + skyline[index].w - skyline[i].x;
+        if (overlap <= 0) break;
+
+        skyline[i].x += overlap;
+        skyline[i].w -= overlap;
+        if (skyline[i].w > 0) break;
+        skyline.erase(skyline.begin() + i);
+    }
+
+    // Merge neighbouring nodes of the same height
+    for (std::size_t i = 0; i + 1 < skyline.size();) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].w += skyline[i + 1].w;
+            skyline.erase(skyline.begin() + i + 1);
+        } else ++i;
+    }
+
+    ++page.imageCount;
+    page.usedArea += static_cast<std::size_t>(rect.w) * rect.h;
+}
+
+/**
+ * @return The index of the new page, or `-1` on failure.
+*/
+int tile::Data_Atlas::createPage(SDL_Renderer* renderer, Pool pool) {
+    auto texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, mPageSize.x, mPageSize.y);
+    if (texture == nullptr) return -1;
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    auto it = std::find_if(mPages.begin(), mPages.end(), [](Data_Page const& page) { return page.texture == nullptr; });
+    if (it == mPages.end()) it = mPages.emplace(mPages.end());
+
+    it->texture = texture;
+    it->skyline = { { 0, 0, mPageSize.x } };
+    it->pool = pool;
+    return static_cast<int>(it - mPages.begin());
+}
+
+
+/**
+ * @return `false` if the queue is full, in which case `event` is dropped.
+*/
+bool tile::Data_AnimationEventQueue::push(Data_AnimationEvent const& event) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mSize == kCapacity) return false;
+    mData[(mHead + mSize) % kCapacity] = event;
+    ++mSize;
+    return true;
+}
+
+std::optional<tile::Data_AnimationEvent> tile::Data_AnimationEventQueue::pop() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mSize) return std::nullopt;
+    auto event = mData[mHead];
+    mHead = (mHead + 1) % kCapacity;
+    --mSize;
+    return event;
+}
+
+void tile::Data_AnimationEventQueue::clear() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mHead = mSize = 0;
+}
+
+
+/**
+ * @brief Retrieve the tileset located at `path`, loading it if not already cached.
+ * @note If `path` is being prefetched, wait for the background load instead of starting over.
+ * @note Newly loaded tilesets might trigger the eviction of unused ones.
+*/
+std::shared_ptr<const tile::Data_EntityTileset> tile::Data_EntityTilesetCache::get(std::filesystem::path const& path, SDL_Renderer* renderer) {
+    auto key = path.generic_string();
+    auto it = mUMap.find(key);
+    if (it != mUMap.end()) {
+        it->second.lastAccess = ++mAccessCounter;
+        return it->second.data;
+    }
+
+    Data_Staged staged;
+    auto pending = mPending.find(key);
+    if (pending != mPending.end()) {
+        staged = pending->second.get();
+        mPending.erase(pending);
+    } else staged = stage(path);
+
+    auto data = new Data_EntityTileset(std::move(staged.data));
+    std::size_t textureMemory = 0;
+    if (staged.surface != nullptr) {
+        data->loadTexture(staged.surface, renderer);   // Must be performed on the thread that owns `renderer`
+        textureMemory = static_cast<std::size_t>(staged.surface->w) * staged.surface->h * SDL_BYTESPERPIXEL(SDL_PIXELFORMAT_RGBA32);   // Only the packed portion of the page is accounted for
+        SDL_FreeSurface(staged.surface);
+    }
+
+    std::shared_ptr<const Data_EntityTileset> result(data, [](Data_EntityTileset* data) {
+        data->clear();
+        delete data;
+    });
+
+    mUMap.emplace(key, Data_Entry{ result, textureMemory, ++mAccessCounter });
+    mTextureMemory += textureMemory;
+
+    trim(config::entities::tilesetMemoryBudget);
+    return result;
+}
+
+/**
+ * @brief Parse the tileset located at `path` and decode its image on a background thread. The texture is created upon the next call to `get()`.
+*/
+void tile::Data_EntityTilesetCache::prefetch(std::filesystem::path const& path) {
+    auto key = path.generic_string();
+    if (mUMap.find(key) != mUMap.end() || mPending.find(key) != mPending.end()) return;
+
+    mPending.emplace(key, std::async(std::launch::async, &Data_EntityTilesetCache::stage, path));
+}
+
+/**
+ * @brief Evict unused tilesets, least recently used first, until the total texture memory does not exceed `budget`.
+ * @note Tilesets in use are never evicted, hence `budget` might remain exceeded.
+*/
+void tile::Data_EntityTilesetCache::trim(std::size_t budget) {
+    while (mTextureMemory > budget) {
+        auto victim = mUMap.end();
+        for (auto it = mUMap.begin(); it != mUMap.end(); ++it) {
+            if (it->second.data.use_count() > 1) continue;   // Referenced outside of the cache
+            if (victim == mUMap.end() || it->second.lastAccess < victim->second.lastAccess) victim = it;
+        }
+        if (victim == mUMap.end()) return;
+
+        mTextureMemory -= victim->second.textureMemory;
+        mUMap.erase(victim);
+    }
+}
+
+/**
+ * @note Tilesets still referenced elsewhere are released along with their last reference.
+*/
+void tile::Data_EntityTilesetCache::clear() {
+    for (auto& pair : mPending) {
+        auto staged = pair.second.get();
+        if (staged.surface != nullptr) SDL_FreeSurface(staged.surface);
+    }
+    mPending.clear();
+    mUMap.clear();
+    mTextureMemory = 0;
 }
 
-bool tile::Data_EntityTileset::equal_to::operator()(std::pair<Animation, SDL_Point> const& first, std::pair<Animation, SDL_Point> const& second) const {
-    return first.first == second.first && first.second == second.second;
-}
\ No newline at end of file
+/**
+ * @note Thread-safe, since no SDL renderer is involved.
+*/
+tile::Data_EntityTilesetCache::Data_Staged tile::Data_EntityTilesetCache::stage(std::filesystem::path const& path) {
+    Data_Staged staged;
+
+    pugi::xml_document document;
+    pugi::xml_parse_result result = document.load_file(path.c_str()); if (!result) return staged;   // Should be replaced with `result.status` or `pugi::xml_parse_status`
+
+    staged.data.load(document, nullptr);
+    auto imagePath = Data_Generic::getImagePath(document);
+    if (imagePath.has_value()) staged.surface = IMG_Load(imagePath.value().string().c_str());
+
+    return staged;
+}
+
+
+tile::Data_Atlas tile::atlas;
+tile::Data_EntityTilesetCache tile::cache;
+tile::Data_AnimationEventQueue tile::events;
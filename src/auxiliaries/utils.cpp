@@ -16,6 +16,8 @@
 #include <pugixml/pugixml.hpp>
 #include <zlib/zlib.h>
 
+#include <pixel-kernels.hpp>
+
 
 bool operator==(SDL_Point const& first, SDL_Point const& second) {
     return first.x == second.x && first.y == second.y;
@@ -265,14 +267,11 @@ SDL_Texture* utils::duplicateTexture(SDL_Renderer* renderer, SDL_Texture* textur
 
 /**
  * @brief Convert a texture to grayscale.
+ * @note Pixels are converted in bulk by `pixel::grayscale()`, which uses whichever SIMD instruction set the CPU supports.
  * @see https://gigi.nullneuron.net/gigilabs/converting-an-image-to-grayscale-using-sdl2/
  * @see https://en.wikipedia.org/wiki/Grayscale
 */
 SDL_Texture* utils::createGrayscaleTexture(SDL_Renderer* renderer, SDL_Texture* texture, double intensity) {
-    constexpr auto grayscale = [](SDL_Color const& color) {
-        return static_cast<uint8_t>(0.212671f * color.r + 0.715160f * color.g + 0.072169f * color.b);
-    };
-
     if (intensity <= 0 || texture == nullptr) return texture;
     if (intensity > 1) intensity = 1;
 
@@ -280,26 +279,12 @@ SDL_Texture* utils::createGrayscaleTexture(SDL_Renderer* renderer, SDL_Texture*
     SDL_Point size;
     SDL_QueryTexture(texture, nullptr, nullptr, &size.x, &size.y);
 
-    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, size.x, size.y, 32, SDL_PIXELFORMAT_RGBA32);   // Also needs to be same format?
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, size.x, size.y, 32, SDL_PIXELFORMAT_RGBA32);   // `pixel` kernels operate on this format only
     if (surface == nullptr) return nullptr;
     SDL_RenderReadPixels(renderer, nullptr, surface->format->format, surface->pixels, surface->pitch);   // Copy texture to surface
 
     // Convert surface to grayscale
-    for (int y = 0; y < size.y; ++y) {
-        for (int x = 0; x < size.x; ++x) {
-            uint32_t& pixel = *(reinterpret_cast<uint32_t*>(surface->pixels) + y * (size.x) + x);   // Provide access to pixel `(x, y)` of `surface`
-
-            SDL_Color color;
-            SDL_GetRGBA(pixel, surface->format, &color.r, &color.g, &color.b, &color.a);   // Extract color from pixel
-
-            uint8_t grayscaledPixel = grayscale(color);   // Create grayscaled pixel (100% intensity) from extracted color
-            color.r = (1 - intensity) * color.r + intensity * grayscaledPixel;
-            color.g = (1 - intensity) * color.g + intensity * grayscaledPixel;
-            color.b = (1 - intensity) * color.b + intensity * grayscaledPixel;
-
-            pixel = SDL_MapRGBA(surface->format, color.r, color.g, color.b, color.a);   // Register changes
-        }
-    }
+    pixel::grayscale(surface, static_cast<unsigned int>(std::lround(intensity * 256)));
 
     // Create new texture from grayscaled surface
     SDL_Texture* grayscaledTexture = SDL_CreateTextureFromSurface(renderer, surface);
@@ -310,6 +295,18 @@ SDL_Texture* utils::createGrayscaleTexture(SDL_Renderer* renderer, SDL_Texture*
     return grayscaledTexture;
 }
 
+/**
+ * @return An estimation of the video memory occupied by `texture`, in bytes.
+*/
+std::size_t utils::getTextureMemory(SDL_Texture* texture) {
+    if (texture == nullptr) return 0;
+
+    Uint32 format;
+    int w, h;
+    if (SDL_QueryTexture(texture, &format, nullptr, &w, &h)) return 0;
+    return static_cast<std::size_t>(w) * h * SDL_BYTESPERPIXEL(format);
+}
+
 /**
  * @brief Set color modulation on the texture of derived class `T`.
 */
@@ -11,51 +11,25 @@
 #include <auxiliaries.hpp>
 
 
-void IngameDialogueBox::BMPFont::Map::insert(char c, Data_Glyph_Storage const& data) {
-    mGlyphDataUMap.insert(std::make_pair(c, data));
-}
-
-IngameDialogueBox::BMPFont::Data_Glyph_Query IngameDialogueBox::BMPFont::Map::operator[](char c) const {
-    Data_Glyph_Query data;
-
-    // Same for every glyph
-    data.srcRect.y = 0;
-    data.srcRect.h = mGlyphHeight;
-
-    auto it = mGlyphDataUMap.find(c);
-    if (it != mGlyphDataUMap.end()) {
-        data.srcRect.w = it->second.width;
-        data.advance = it->second.advance;
-    }
-
-    // The sum of all "previous" glyphWidths
-    data.srcRect.x = 0;
-    for (const auto& pair : mGlyphDataUMap) {
-        if (pair.first >= c) break;
-        data.srcRect.x += pair.second.width;
-    }
-
-    return data;
-}
-
-
 IngameDialogueBox::BMPFont::BMPFont(ComponentPreset const& preset) : mPreset(preset) {}
 
 IngameDialogueBox::BMPFont::~BMPFont() {
-    // `~Map()` automatically called
     if (mTexture != nullptr) {
         SDL_DestroyTexture(mTexture);
         mTexture = nullptr;
     }
 }
 
+/**
+ * @brief Render every supported char of `font` into `mTexture`, side by side, and compile their source rects into `mGlyphs`.
+*/
 void IngameDialogueBox::BMPFont::load(TTF_Font* font) {
     mSrcSize.x = 0;
     mSrcSize.y = TTF_FontHeight(font);
-    mSrcRectsMap.setGlyphHeight(mSrcSize.y);
+    mGlyphs.fill({});
 
     const std::string chars = getChars();
-    for (const auto& c : chars) registerCharToMap(font, c);
+    for (const auto& c : chars) registerCharToTable(font, c);
 
     if (mTexture != nullptr) SDL_DestroyTexture(mTexture);
     mTexture = SDL_CreateTexture(globals::renderer, SDL_PixelFormatEnum::SDL_PIXELFORMAT_RGBA32, SDL_TextureAccess::SDL_TEXTUREACCESS_TARGET, mSrcSize.x, mSrcSize.y);
@@ -74,62 +48,105 @@ void IngameDialogueBox::BMPFont::setRenderTarget(SDL_Texture*& targetTexture) {
 }
 
 /**
- * @brief Render char `c` to `texture` in common dialogue text style.
+ * @brief Discard the current line, then clear `mTargetTexture`.
+*/
+void IngameDialogueBox::BMPFont::clear() {
+    mLayout.clear();
+    mRevealedCount = 0;
+    clearTarget();
+}
+
+/**
+ * @brief Compute the placement of every char of `text` within `mTargetTexture` in common dialogue text style, replacing the current line.
+ * @note Chars overflowing the width of `mTargetTexture` wrap onto the next row. Rows overflowing its height start a new page i.e. `mTargetTexture` is cleared once the first char of that page is revealed.
 */
-void IngameDialogueBox::BMPFont::render(char c) const {
-    static auto endOfLine = [&]() {
-        mGlyphOrigin.x = 0;
-        mGlyphOrigin.y += mSrcSize.y + mSpacing.y;
+void IngameDialogueBox::BMPFont::layout(std::string const& text) {
+    clear();
+    mLayout.resize(text.size());
+
+    SDL_Point glyphOrigin = { 0, 0 };
+    auto endOfLine = [&]() {
+        glyphOrigin.x = 0;
+        glyphOrigin.y += mSrcSize.y + mSpacing.y;
     };
 
-    switch (c) {
-        case ' ':
-            mGlyphOrigin.x += mSrcSize.y / 2 + mSpacing.x;
-            return;
+    for (std::size_t index = 0; index < text.size(); ++index) {
+        auto& placement = mLayout[index];
 
-        case '\n':
-            endOfLine();
-            return;
+        switch (text[index]) {
+            case ' ':
+                glyphOrigin.x += mSrcSize.y / 2 + mSpacing.x;
+                continue;
 
-        case '\0':
-            clear();
-            return;
+            case '\n':
+                endOfLine();
+                continue;
 
-        default: break;
-    }
+            case '\0':
+                placement.isPageBreak = true;
+                glyphOrigin = { 0, 0 };
+                continue;
 
-    const auto data = mSrcRectsMap[c];
-    if (!data.srcRect.w) return;
+            default: break;
+        }
 
-    SDL_Rect chrDestRect;
-    chrDestRect.w = data.srcRect.w;
-    chrDestRect.h = data.srcRect.h;
+        auto const& glyph = mGlyphs[static_cast<unsigned char>(text[index])];
+        if (!glyph.srcRect.w) continue;
 
-    if (mGlyphOrigin.x + chrDestRect.w > mTargetTextureSize.x) { if (mGlyphOrigin.y + chrDestRect.h > mTargetTextureSize.y) clear(); else endOfLine(); }
+        if (glyphOrigin.x + glyph.srcRect.w > mTargetTextureSize.x) {
+            if (glyphOrigin.y + glyph.srcRect.h > mTargetTextureSize.y) {
+                placement.isPageBreak = true;
+                glyphOrigin = { 0, 0 };
+            } else endOfLine();
+        }
 
-    chrDestRect.x = mGlyphOrigin.x;
-    chrDestRect.y = mGlyphOrigin.y;
-    mGlyphOrigin.x += data.advance + mSpacing.x;
+        placement.srcRect = glyph.srcRect;
+        placement.destRect = { glyphOrigin.x, glyphOrigin.y, glyph.srcRect.w, glyph.srcRect.h };
+        glyphOrigin.x += glyph.advance + mSpacing.x;
+    }
+}
 
-    auto cachedRenderTarget = SDL_GetRenderTarget(globals::renderer);
-    SDL_SetRenderTarget(globals::renderer, mTargetTexture);
-    SDL_RenderCopy(globals::renderer, mTexture, &data.srcRect, &chrDestRect);
-    SDL_SetRenderTarget(globals::renderer, cachedRenderTarget);
+/**
+ * @brief Queue the chars of the current line up to, but excluding, the `count`-th one. Chars already revealed are not queued again, hence typewriter progress only costs the newly revealed chars.
+ * @note Glyphs are only rendered upon `flush()`, which binds `mTargetTexture` once for all of them.
+*/
+void IngameDialogueBox::BMPFont::reveal(std::size_t count) const {
+    count = std::min(count, mLayout.size());
+
+    for (; mRevealedCount < count; ++mRevealedCount) {
+        auto const& placement = mLayout[mRevealedCount];
+        if (placement.isPageBreak) clearTarget();
+        if (placement.srcRect.w) mBatch.draw(mTexture, placement.srcRect, placement.destRect);
+    }
 }
 
-void IngameDialogueBox::BMPFont::clear() const {
-    auto cachedRenderTarget = SDL_GetRenderTarget(globals::renderer);
-    SDL_SetRenderTarget(globals::renderer, mTargetTexture);
-    utils::setRendererDrawColor(globals::renderer, mPreset.backgroundColor);
-    SDL_RenderClear(globals::renderer);
-    SDL_SetRenderTarget(globals::renderer, cachedRenderTarget);
+/**
+ * @brief Render pending glyphs to `mTargetTexture`.
+*/
+void IngameDialogueBox::BMPFont::flush() const {
+    if (mBatch.empty()) return;
+
+    auto cachedRenderTarget = globals::renderCommands.getRenderTarget();
+    globals::renderCommands.setRenderTarget(mTargetTexture);
+    mBatch.flush(globals::renderer);
+    globals::renderCommands.setRenderTarget(cachedRenderTarget);
+}
 
-    mGlyphOrigin = { 0, 0 };
+/**
+ * @note Pending glyphs are discarded, since `mTargetTexture` is cleared anyway.
+*/
+void IngameDialogueBox::BMPFont::clearTarget() const {
+    mBatch.clear();
+
+    auto cachedRenderTarget = globals::renderCommands.getRenderTarget();
+    globals::renderCommands.setRenderTarget(mTargetTexture);
+    globals::renderCommands.setRenderDrawColor(mPreset.backgroundColor);
+    globals::renderCommands.renderClear();
+    globals::renderCommands.setRenderTarget(cachedRenderTarget);
 }
 
 /**
  * @brief Retrieve all supported chars.
- * @note Must be ORDERED for `Map` to work.
 */
 std::string IngameDialogueBox::BMPFont::getChars() const {
     std::string chars;
@@ -141,45 +158,46 @@ std::string IngameDialogueBox::BMPFont::getChars() const {
     for (char c = '0'; c <= '9'; ++c) chars += c;
     chars.append(symbols);
 
-    std::sort(chars.begin(), chars.end());   // Really, really, really important!
-
     return chars;
 }
 
 /**
+ * @brief Assign `c` the next slot of `mTexture`, to the right of previously registered chars.
  * @see https://freetype.sourceforge.net/freetype2/docs/tutorial/step2.html
 */
-void IngameDialogueBox::BMPFont::registerCharToMap(TTF_Font* font, char c) {
+void IngameDialogueBox::BMPFont::registerCharToTable(TTF_Font* font, char c) {
     if (TTF_GlyphIsProvided32(font, c) == 0) return;
 
-    Data_Glyph_Storage data;
+    auto& glyph = mGlyphs[static_cast<unsigned char>(c)];
 
     // Query glyph width
     SDL_Surface* surface = sTextRenderMethod(font, c, mPreset.textColor, mPreset.backgroundColor);
-    data.width = surface->w;
+    if (surface == nullptr) return;
+    glyph.srcRect = { mSrcSize.x, 0, surface->w, mSrcSize.y };
     SDL_FreeSurface(surface);
 
     // Query glyph advance i.e. distance between 2 adjacent origins
-    TTF_GlyphMetrics32(font, c, nullptr, nullptr, nullptr, nullptr, &data.advance);
+    TTF_GlyphMetrics32(font, c, nullptr, nullptr, nullptr, nullptr, &glyph.advance);
 
-    mSrcRectsMap.insert(c, data);
-    mSrcSize.x += data.width;
+    mSrcSize.x += glyph.srcRect.w;
 }
 
 void IngameDialogueBox::BMPFont::registerCharToTexture(TTF_Font* font, char c) const {
+    auto const& srcRect = mGlyphs[static_cast<unsigned char>(c)].srcRect;
+    if (!srcRect.w) return;
+
     SDL_Surface* surface = sTextRenderMethod(font, c, mPreset.textColor, mPreset.backgroundColor);
     if (surface == nullptr) return;
 
     SDL_Texture* texture = SDL_CreateTextureFromSurface(globals::renderer, surface);
     SDL_FreeSurface(surface);
 
-    auto srcRect = mSrcRectsMap[c].srcRect;
     SDL_RenderCopy(globals::renderer, texture, nullptr, &srcRect);
     SDL_DestroyTexture(texture);
 }
 
 
-IngameDialogueBox::IngameDialogueBox(SDL_FPoint const& center, ComponentPreset const& preset) : GenericComponent<IngameDialogueBox>(center, preset), GenericBoxComponent<IngameDialogueBox>(center, preset), mBMPFont(preset) {}
+IngameDialogueBox::IngameDialogueBox(SDL_FPoint const& center, ComponentPreset const& preset) : GenericBoxComponent<IngameDialogueBox>(center, preset), mBMPFont(preset) {}
 
 IngameDialogueBox::~IngameDialogueBox() {
     if (mTextTexture != nullptr) {
@@ -187,15 +205,16 @@ IngameDialogueBox::~IngameDialogueBox() {
         mTextTexture = nullptr;
     }
     if (mFont != nullptr) {
-        TTF_CloseFont(mFont);
+        globals::fonts.release(mFont);
         mFont = nullptr;
     }
 }
 
 void IngameDialogueBox::render() const {
     GenericBoxComponent<IngameDialogueBox>::render();
-    if (mStatus == Status::kUpdateInProgress) mBMPFont.render(mContents.front()[mCurrProgress]);
-    SDL_RenderCopy(globals::renderer, mTextTexture, nullptr, &mTextDestRect);
+    if (mStatus == Status::kUpdateInProgress) mBMPFont.reveal(mCurrProgress + 1);
+    mBMPFont.flush();
+    globals::renderCommands.renderCopy(mTextTexture, nullptr, &mTextDestRect);
 }
 
 void IngameDialogueBox::onWindowChange() {
@@ -212,13 +231,18 @@ void IngameDialogueBox::onWindowChange() {
     if (mTextTexture != nullptr) SDL_DestroyTexture(mTextTexture);
     mTextTexture = SDL_CreateTexture(globals::renderer, SDL_PixelFormatEnum::SDL_PIXELFORMAT_RGBA32, SDL_TextureAccess::SDL_TEXTUREACCESS_TARGET, mTextDestRect.w, mTextDestRect.h);
 
-    if (mFont != nullptr) TTF_CloseFont(mFont);
-    mFont = TTF_OpenFont(sFontPath.generic_string().c_str(), getFontSize(sDestSize));
+    auto font = globals::fonts.acquire(sFontPath, getFontSize(sDestSize));
+    if (mFont != nullptr) globals::fonts.release(mFont);
+    mFont = font;
 
-    mBMPFont.clear();
     mBMPFont.load(mFont);
     mBMPFont.setRenderTarget(mTextTexture);
-    if (mStatus == Status::kUpdateInProgress) for (unsigned short int progress = 0; progress <= mCurrProgress; ++progress) mBMPFont.render(mContents.front()[progress]);   // Retain progress
+    if (mStatus != Status::kInactive) {
+        // Retain progress
+        mBMPFont.layout(mContents.front());
+        mBMPFont.reveal(mCurrProgress + 1);
+    }
+    mBMPFont.flush();
 }
 
 void IngameDialogueBox::handleKeyBoardEvent(SDL_Event const& event) {
@@ -276,6 +300,7 @@ void IngameDialogueBox::enqueueContent(std::string const& content) {
     if (mStatus != Status::kInactive || content.empty()) return;
 
     mContents.push(content);
+    mBMPFont.layout(mContents.front());
 
     mCurrProgress = 0;
     mStatus = Status::kUpdateInProgress;
@@ -286,6 +311,8 @@ void IngameDialogueBox::enqueueContents(std::vector<std::string> const& contents
     if (mStatus != Status::kInactive || mDelayCounter) return;
 
     for (const auto& content : contents) if (!content.empty()) mContents.push(content);
+    if (mContents.empty()) return;
+    mBMPFont.layout(mContents.front());
 
     mCurrProgress = 0;
     mDelayCounter = sDelayCounterLimit;   // Reset
@@ -311,6 +338,7 @@ void IngameDialogueBox::close() {
     mContents.pop();
 
     if (!mContents.empty()) {
+        mBMPFont.layout(mContents.front());
         mCurrProgress = 0;
         mStatus = Status::kUpdateInProgress;
     } else {
@@ -322,9 +350,9 @@ void IngameDialogueBox::close() {
 void IngameDialogueBox::skip() {
     if (mStatus != Status::kUpdateInProgress) return;
 
-    const auto prevProgress = mCurrProgress;
     mCurrProgress = static_cast<unsigned short int>(mContents.front().size()) - 1;
-    for (auto progress = prevProgress; progress < mCurrProgress; ++progress) mBMPFont.render(mContents.front()[progress]);
+    mBMPFont.reveal(mCurrProgress + 1);
+    mBMPFont.flush();
 }
 
 
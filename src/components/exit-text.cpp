@@ -6,13 +6,15 @@
 #include <auxiliaries.hpp>
 
 
-ExitText::ExitText(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericComponent<ExitText>(center, preset), GenericTextComponent<ExitText>(center, preset, content) {}
+ExitText::ExitText(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericTextComponent<ExitText>(center, preset, content) {}
 
 void ExitText::deinitialize() {
     Singleton<ExitText>::deinitialize();
     if (sFont != nullptr) {
-        TTF_CloseFont(sFont);
+        globals::fonts.release(sFont);
         sFont = nullptr;
+        sGlyphAtlas = nullptr;
+        sFontSize = 0;
     }
 }
 
@@ -43,14 +45,14 @@ void ExitText::handleKeyBoardEvent(SDL_Event const& event) {
 }
 
 /**
- * @brief Set transparency of `textTexture`.
+ * @brief Set transparency of the text.
  * @see <src/components/generic-progress-bar.cpp> GenericProgressBarComponent<T>::updateAnimation()
 */
 void ExitText::registerProgress() {
     auto eq = [](double progress) {
         return std::sqrt(1.0 - pow(progress - 1.0, 2));
     };
-    SDL_SetTextureAlphaMod(mTextTexture, SDL_ALPHA_OPAQUE * eq(mCurrProgress));
+    mTextAlpha = static_cast<Uint8>(SDL_ALPHA_OPAQUE * eq(mCurrProgress));
 }
 
 
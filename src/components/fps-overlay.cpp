@@ -6,13 +6,15 @@
 #include <auxiliaries.hpp>
 
 
-FPSOverlay::FPSOverlay(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericComponent<FPSOverlay>(center, preset), GenericTextBoxComponent<FPSOverlay>(center, preset, content) {}
+FPSOverlay::FPSOverlay(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericTextBoxComponent<FPSOverlay>(center, preset, content) {}
 
 void FPSOverlay::deinitialize() {
     Singleton<FPSOverlay>::deinitialize();
     if (sFont != nullptr) {
-        TTF_CloseFont(sFont);
+        globals::fonts.release(sFont);
         sFont = nullptr;
+        sGlyphAtlas = nullptr;
+        sFontSize = 0;
     }
 }
 
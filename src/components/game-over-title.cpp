@@ -6,13 +6,15 @@
 #include <auxiliaries.hpp>
 
 
-GameOverTitle::GameOverTitle(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericComponent<GameOverTitle>(center, preset), GenericTextComponent<GameOverTitle>(center, preset, content) {}
+GameOverTitle::GameOverTitle(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericTextComponent<GameOverTitle>(center, preset, content) {}
 
 void GameOverTitle::deinitialize() {
     Singleton<MenuTitle>::deinitialize();
     if (sFont != nullptr) {
-        TTF_CloseFont(sFont);
+        globals::fonts.release(sFont);
         sFont = nullptr;
+        sGlyphAtlas = nullptr;
+        sFontSize = 0;
     }
 }
 
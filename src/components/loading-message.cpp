@@ -6,13 +6,15 @@
 #include <auxiliaries.hpp>
 
 
-LoadingMessage::LoadingMessage(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericComponent<LoadingMessage>(center, preset), GenericTextComponent<LoadingMessage>(center, preset, content) {}
+LoadingMessage::LoadingMessage(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericTextComponent<LoadingMessage>(center, preset, content) {}
 
 void LoadingMessage::deinitialize() {
     Singleton<LoadingMessage>::deinitialize();
     if (sFont != nullptr) {
-        TTF_CloseFont(sFont);
+        globals::fonts.release(sFont);
         sFont = nullptr;
+        sGlyphAtlas = nullptr;
+        sFontSize = 0;
     }
 }
 
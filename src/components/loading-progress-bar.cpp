@@ -4,7 +4,7 @@
 #include <auxiliaries.hpp>
 
 
-LoadingProgressBar::LoadingProgressBar(SDL_FPoint const& center, ComponentPreset const& preset) : GenericComponent<LoadingProgressBar>(center, preset), GenericProgressBarComponent<LoadingProgressBar>(center, preset) {}
+LoadingProgressBar::LoadingProgressBar(SDL_FPoint const& center, ComponentPreset const& preset) : GenericProgressBarComponent<LoadingProgressBar>(center, preset) {}
 
 void LoadingProgressBar::deinitialize() {
     Singleton<LoadingProgressBar>::deinitialize();
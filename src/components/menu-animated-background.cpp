@@ -32,8 +32,8 @@ void MenuParallax::updateAnimation() {
 }
 
 void MenuParallax::render() const {
-    SDL_RenderCopy(globals::renderer, mTexture, &mSrcRects.first, &mDestRects.first);
-    SDL_RenderCopy(globals::renderer, mTexture, &mSrcRects.second, &mDestRects.second);
+    globals::renderCommands.renderCopy(mTexture, &mSrcRects.first, &mDestRects.first);
+    globals::renderCommands.renderCopy(mTexture, &mSrcRects.second, &mDestRects.second);
 }
 
 void MenuParallax::onWindowChange() {
@@ -6,13 +6,15 @@
 #include <auxiliaries.hpp>
 
 
-MenuTitle::MenuTitle(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericComponent<MenuTitle>(center, preset), GenericTextComponent<MenuTitle>(center, preset, content) {}
+MenuTitle::MenuTitle(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericTextComponent<MenuTitle>(center, preset, content) {}
 
 void MenuTitle::deinitialize() {
     Singleton<MenuTitle>::deinitialize();
     if (sFont != nullptr) {
-        TTF_CloseFont(sFont);
+        globals::fonts.release(sFont);
         sFont = nullptr;
+        sGlyphAtlas = nullptr;
+        sFontSize = 0;
     }
 }
 
@@ -4,30 +4,27 @@
 #include <auxiliaries.hpp>
 
 
-template <typename T>
-GenericBoxComponent<T>::GenericBoxComponent(SDL_FPoint const& center, ComponentPreset const& preset) : GenericComponent<T>(center, preset) {}
-
-template <typename T>
-GenericBoxComponent<T>::~GenericBoxComponent() {
+template <typename T, typename Base>
+GenericBoxComponent<T, Base>::~GenericBoxComponent() {
     if (mBoxTexture != nullptr) {
         SDL_DestroyTexture(mBoxTexture);
         mBoxTexture = nullptr;
     }
 }
 
-template <typename T>
-void GenericBoxComponent<T>::render() const {
-    SDL_RenderCopy(globals::renderer, mBoxTexture, nullptr, &mBoxDestRect);
+template <typename T, typename Base>
+void GenericBoxComponent<T, Base>::render() const {
+    globals::renderCommands.renderCopy(mBoxTexture, nullptr, &mBoxDestRect);
 }
 
-template <typename T>
-void GenericBoxComponent<T>::onWindowChange() {
-    GenericComponent<T>::onWindowChange();
+template <typename T, typename Base>
+void GenericBoxComponent<T, Base>::onWindowChange() {
+    Base::onWindowChange();
     loadBoxTexture(mBoxTexture, kPreset);
 }
 
-template <typename T>
-void GenericBoxComponent<T>::shrinkRect(SDL_Rect& rect, const float ratio) {
+template <typename T, typename Base>
+void GenericBoxComponent<T, Base>::shrinkRect(SDL_Rect& rect, const float ratio) {
     int delta = utils::ftoi(std::min(rect.w, rect.h) / 2 * ratio);
     rect.x += delta;
     rect.y += delta;
@@ -35,8 +32,8 @@ void GenericBoxComponent<T>::shrinkRect(SDL_Rect& rect, const float ratio) {
     rect.h -= delta * 2;
 }
 
-template <typename T>
-void GenericBoxComponent<T>::loadBoxTexture(SDL_Texture*& texture, ComponentPreset const& preset) {
+template <typename T, typename Base>
+void GenericBoxComponent<T, Base>::loadBoxTexture(SDL_Texture*& texture, ComponentPreset const& preset) {
     if (texture != nullptr) SDL_DestroyTexture(texture);
     
     mBoxDestRect.w = sDestSize * kDestRectRatio.x;
@@ -65,8 +62,8 @@ void GenericBoxComponent<T>::loadBoxTexture(SDL_Texture*& texture, ComponentPres
 }
 
 
-template class GenericBoxComponent<FPSOverlay>;
 template class GenericBoxComponent<IngameDialogueBox>;
-template class GenericBoxComponent<MenuButton>;
 template class GenericBoxComponent<LoadingProgressBar>;
-template class GenericBoxComponent<GameOverButton>;
\ No newline at end of file
+template class GenericBoxComponent<FPSOverlay, GenericTextComponent<FPSOverlay>>;
+template class GenericBoxComponent<MenuButton, GenericTextComponent<MenuButton>>;
+template class GenericBoxComponent<GameOverButton, GenericTextComponent<GameOverButton>>;
\ No newline at end of file
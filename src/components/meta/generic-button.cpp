@@ -8,7 +8,7 @@
 
 
 template <typename T>
-GenericButtonComponent<T>::GenericButtonComponent(SDL_FPoint const& center, ComponentPreset const& onMouseOutPreset, ComponentPreset const& onMouseOverPreset, std::string const& content, GameState* destState) : GenericComponent<T>(center, onMouseOutPreset), GenericTextBoxComponent<T>(center, onMouseOutPreset, content), kOnMouseOverPreset(onMouseOverPreset), kTargetGameState(destState) {}
+GenericButtonComponent<T>::GenericButtonComponent(SDL_FPoint const& center, ComponentPreset const& onMouseOutPreset, ComponentPreset const& onMouseOverPreset, std::string const& content, GameState* destState) : GenericTextBoxComponent<T>(center, onMouseOutPreset, content), kOnMouseOverPreset(onMouseOverPreset), kTargetGameState(destState) {}
 
 /**
  * @see https://wiki.libsdl.org/SDL2/SDL_SystemCursor
@@ -36,15 +36,14 @@ void GenericButtonComponent<T>::deinitialize() {
 
 template <typename T>
 void GenericButtonComponent<T>::render() const {
-    SDL_RenderCopy(globals::renderer, (mIsMouseOut ? mBoxTexture : mBoxTextureOnMouseOver), nullptr, &mBoxDestRect);
-    SDL_RenderCopy(globals::renderer, (mIsMouseOut ? mTextTexture : mTextTextureOnMouseOver), nullptr, &mTextDestRect);
+    globals::renderCommands.renderCopy((mIsMouseOut ? mBoxTexture : mBoxTextureOnMouseOver), nullptr, &mBoxDestRect);
+    renderText(mIsMouseOut ? kPreset : kOnMouseOverPreset);
 }
 
 template <typename T>
 void GenericButtonComponent<T>::onWindowChange() {
     GenericTextBoxComponent<T>::onWindowChange();
     loadBoxTexture(mBoxTextureOnMouseOver, kOnMouseOverPreset);
-    loadTextTexture(mTextTextureOnMouseOver, kOnMouseOverPreset);
 }
 
 template <typename T>
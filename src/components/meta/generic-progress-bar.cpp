@@ -9,18 +9,18 @@
 
 
 template <typename T>
-GenericProgressBarComponent<T>::GenericProgressBarComponent(SDL_FPoint const& center, ComponentPreset const& preset) : GenericComponent<T>(center, preset), GenericBoxComponent<T>(center, preset) {}
+GenericProgressBarComponent<T>::GenericProgressBarComponent(SDL_FPoint const& center, ComponentPreset const& preset) : GenericBoxComponent<T>(center, preset) {}
 
 
 template <typename T>
 void GenericProgressBarComponent<T>::render() const {
     GenericBoxComponent<T>::render();
 
-    utils::setRendererDrawColor(globals::renderer, kPreset.lineColor);
-    SDL_RenderFillRect(globals::renderer, &mProgressDestRects.first);
+    globals::renderCommands.setRenderDrawColor(kPreset.lineColor);
+    globals::renderCommands.renderFillRect(&mProgressDestRects.first);
 
-    utils::setRendererDrawColor(globals::renderer, kPreset.backgroundColor);
-    SDL_RenderFillRect(globals::renderer, &mProgressDestRects.second);
+    globals::renderCommands.setRenderDrawColor(kPreset.backgroundColor);
+    globals::renderCommands.renderFillRect(&mProgressDestRects.second);
 }
 
 template <typename T>
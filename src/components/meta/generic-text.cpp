@@ -8,72 +8,86 @@ template <typename T>
 GenericTextComponent<T>::GenericTextComponent(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericComponent<T>(center, preset), mContent(content) {}
 
 template <typename T>
-GenericTextComponent<T>::~GenericTextComponent() {
-    if (mTextTexture != nullptr) {
-        SDL_DestroyTexture(mTextTexture);
-        mTextTexture = nullptr;
-    }
-}
+GenericTextComponent<T>::~GenericTextComponent() = default;
 
 template <typename T>
 void GenericTextComponent<T>::deinitialize() {
     Multiton<T>::deinitialize();
     if (sFont != nullptr) {
-        TTF_CloseFont(sFont);
+        globals::fonts.release(sFont);
         sFont = nullptr;
+        sGlyphAtlas = nullptr;
+        sFontSize = 0;
     }
 }
 
 template <typename T>
 void GenericTextComponent<T>::render() const {
-    SDL_RenderCopy(globals::renderer, mTextTexture, nullptr, &mTextDestRect);
+    renderText(kPreset);
 }
 
 template <typename T>
 void GenericTextComponent<T>::onWindowChange() {
     static constexpr auto loadFont = [&]() {
-        if (sFont != nullptr) {
-            if (TTF_FontHeight(sFont) == sDestSize) return;
-            TTF_CloseFont(sFont);
-        }
+        if (sFont != nullptr && sFontSize == sDestSize) return;
+
+        // Acquire prior to releasing, so that a size shared with no one else is not closed in between
+        auto font = globals::fonts.acquire(sFontPath, sDestSize);
+        if (sFont != nullptr) globals::fonts.release(sFont);
 
-        sFont = TTF_OpenFont(sFontPath.generic_string().c_str(), sDestSize);   // Prevent `error: cannot convert 'const std::filesystem::__cxx11::path::value_type*' {aka 'const wchar_t*'} to 'const char*'`
+        sFont = font;
+        sGlyphAtlas = globals::fonts.getGlyphAtlas(sFont);
+        sFontSize = sDestSize;
     };
 
     GenericComponent<T>::onWindowChange();
     loadFont();
-    loadTextTexture(mTextTexture, kPreset);
+    loadTextLayout();
 }
 
+/**
+ * @brief Center `mTextDestRect` around `kCenter`, sized after the layout of `mContent`.
+*/
 template <typename T>
-void GenericTextComponent<T>::loadTextTexture(SDL_Texture*& texture, ComponentPreset const& preset) {
-    if (texture != nullptr) SDL_DestroyTexture(texture);
-
-    // Render text at high quality
-    SDL_Surface* surface = TTF_RenderUTF8_Blended(sFont, mContent.c_str(), preset.textColor);
-    if (surface == nullptr) return;
-
-    texture = SDL_CreateTextureFromSurface(globals::renderer, surface);
-    
-    // Register `innerSurface` dimensions to `innerDestRect`
-    mTextDestRect.w = surface->w;
-    mTextDestRect.h = surface->h;
+void GenericTextComponent<T>::loadTextLayout() {
+    const SDL_Point size = sGlyphAtlas != nullptr ? sGlyphAtlas->layout(mContent).size : SDL_Point{ 0, 0 };
+
+    mTextDestRect.w = size.x;
+    mTextDestRect.h = size.y;
     mTextDestRect.x = utils::ftoi(globals::windowSize.x * kCenter.x - mTextDestRect.w / 2);
     mTextDestRect.y = utils::ftoi(globals::windowSize.y * kCenter.y - mTextDestRect.h / 2);
+}
+
+/**
+ * @brief Queue `mContent` in the text color of `preset`, modulated by `mTextAlpha`.
+*/
+template <typename T>
+void GenericTextComponent<T>::renderText(ComponentPreset const& preset) const {
+    if (sGlyphAtlas == nullptr || !mTextAlpha) return;
 
-    SDL_FreeSurface(surface);
+    auto color = preset.textColor;
+    color.a = static_cast<Uint8>(color.a * mTextAlpha / SDL_ALPHA_OPAQUE);
+    sGlyphAtlas->render(globals::batch, mContent, { mTextDestRect.x, mTextDestRect.y }, color, config::batch::textLayer);
 }
 
 template <typename T>
 void GenericTextComponent<T>::editContent(std::string const& nextContent) {
+    if (mContent == nextContent) return;
+
     mContent = nextContent;
-    loadTextTexture(mTextTexture, kPreset);
+    loadTextLayout();
 }
 
 
 template <typename T>
 TTF_Font* GenericTextComponent<T>::sFont = nullptr;
 
+template <typename T>
+GlyphAtlas* GenericTextComponent<T>::sGlyphAtlas = nullptr;
+
+template <typename T>
+int GenericTextComponent<T>::sFontSize = 0;
+
 
 template class GenericTextComponent<FPSOverlay>;
 template class GenericTextComponent<ExitText>;
@@ -5,24 +5,22 @@
 
 
 template <typename T>
-GenericTextBoxComponent<T>::GenericTextBoxComponent(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericComponent<T>(center, preset), GenericTextComponent<T>(center, preset, content), GenericBoxComponent<T>(center, preset) {}
+GenericTextBoxComponent<T>::GenericTextBoxComponent(SDL_FPoint const& center, ComponentPreset const& preset, std::string const& content) : GenericBoxComponent<T, GenericTextComponent<T>>(center, preset, content) {}
 
 template <typename T>
 void GenericTextBoxComponent<T>::deinitialize() {
     GenericTextComponent<T>::deinitialize();
-    GenericBoxComponent<T>::deinitialize();
 }
 
 template <typename T>
 void GenericTextBoxComponent<T>::render() const {
-    GenericBoxComponent<T>::render();
+    GenericBoxComponent<T, GenericTextComponent<T>>::render();
     GenericTextComponent<T>::render();
 }
 
 template <typename T>
 void GenericTextBoxComponent<T>::onWindowChange() {
-    GenericTextComponent<T>::onWindowChange();
-    GenericBoxComponent<T>::onWindowChange();
+    GenericBoxComponent<T, GenericTextComponent<T>>::onWindowChange();   // Also calls `GenericTextComponent<T>::onWindowChange()`
 }
 
 
@@ -87,9 +87,9 @@ void AbstractAnimatedDynamicEntity<T>::initiateMove(BehaviouralType flag) {
 
     if (mNextVelocity == nullptr) { onMoveEnd(BehaviouralType::kInvalidated); return; }
 
-    if (sTilesetData.isMultiDirectional) mPrevDirection = mDirection;
+    if (sTilesetData->isMultiDirectional) mPrevDirection = mDirection;
     mDirection = *mNextVelocity;
-    if (!sTilesetData.isMultiDirectional && mDirection.x) mFlip = (mDirection.x + 1) >> 1 ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;   // The default direction of a sprite in a tileset is right
+    if (!sTilesetData->isMultiDirectional && mDirection.x) mFlip = (mDirection.x + 1) >> 1 ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;   // The default direction of a sprite in a tileset is right
 
     mNextDestCoords = new SDL_Point(mDestCoords + mDirection);
     mNextDestRect = new SDL_Rect(AbstractEntity<T>::getDestRectFromCoords(*mNextDestCoords));
@@ -130,7 +130,7 @@ void AbstractAnimatedDynamicEntity<T>::onMoveStart(BehaviouralType flag) {
     mCurrVelocity = *mNextVelocity;
     mBaseAnimation = mIsRunning ? Animation::kRun : Animation::kWalk;
 
-    resetAnimation(mBaseAnimation, sTilesetData.isMultiDirectional && mDirection != mPrevDirection ? BehaviouralType::kDefault : flag);
+    resetAnimation(mBaseAnimation, sTilesetData->isMultiDirectional && mDirection != mPrevDirection ? BehaviouralType::kDefault : flag);
 }
 
 /**
@@ -1,11 +1,12 @@
 #include <entities.hpp>
 
+#include <array>
 #include <filesystem>
 #include <type_traits>
 
 #include <SDL.h>
 
-#include <mixer.hpp>
+#include <timers.hpp>
 #include <meta.hpp>
 #include <auxiliaries.hpp>
 
@@ -32,39 +33,35 @@ void AbstractAnimatedEntity<T>::onLevelChange(level::Data_Generic const& entityL
 }
 
 /**
- * @note `AnimationType::kWalk` & `AnimationType:kRun` are handled elsewhere.
- * @see https://stackoverflow.com/questions/41011900/equivalent-ternary-operator-for-constexpr-if
+ * @brief Call `updateAnimation()` on every instance.
+ * @note For types opted in via `kIsAmbient`, instances in their idle animation instead share a single phase derived from `globals::frameClock`, computed once per direction, regardless of the number of instances.
 */
 template <typename T>
-void AbstractAnimatedEntity<T>::handleSFX() const {
-    static CountdownTimer timer(config::entities::SFXTicks);
-    if (!timer.isStarted()) timer.start();
-    if (!timer.isFinished()) return;
-
-    switch (mAnimation) {
-        case Animation::kAttackMeele:
-            if (!isAnimationAtFirstSprite()) break;
-            Mixer::invoke(&Mixer::playSFX, std::is_same_v<T, Player> ? Mixer::SFXName::kPlayerAttack : Mixer::SFXName::kEntityAttack);
-            break;
-
-        case Animation::kDamaged:
-            if (!isAnimationAtFirstSprite()) break;
-            Mixer::invoke(&Mixer::playSFX, Mixer::SFXName::kEntityDamaged);
-            break;
-
-        case Animation::kDeath:
-            if (!isAnimationAtFirstSprite()) break;
-            Mixer::invoke(&Mixer::playSFX, std::is_same_v<T, Player> ? Mixer::SFXName::kPlayerDeath : Mixer::SFXName::kEntityDeath);
-            break;
-
-        default: break;
+void AbstractAnimatedEntity<T>::updateAnimationAll() {
+    if constexpr (!kIsAmbient<T>) {
+        invoke(&T::updateAnimation);
+    } else {
+        std::array<tile::Data_EntityTileset::Data_Frame const*, tile::Data_EntityTileset::kDirectionCount> frames{};
+
+        for (auto& instance : instances) {
+            if (instance == nullptr) continue;
+
+            auto direction = sTilesetData->isMultiDirectional ? instance->mDirection : tile::Data_EntityTileset::kDefaultDirection;
+            auto index = tile::Data_EntityTileset::getDirectionIndex(direction);
+            if (instance->mAnimation != Animation::kIdle || index == tile::Data_EntityTileset::kDirectionCount) {
+                instance->updateAnimation();
+                continue;
+            }
+
+            if (frames[index] == nullptr) frames[index] = sTilesetData->getFrameAtPhase(sTilesetData->at(Animation::kIdle, direction), globals::frameClock.getTicks());
+            if (frames[index] != nullptr) instance->mSrcRect = frames[index]->srcRect;
+        }
     }
-
-    timer.start();
 }
 
 /**
  * @brief Switch from one sprite to the next. Called every `animationTicks` frames.
+ * @note Frames are precomputed by `tile::Data_EntityTileset`, hence a bounds check and an array read.
  * @see <interface.h> Interface::renderLevelTiles()
 */
 template <typename T>
@@ -73,18 +70,15 @@ void AbstractAnimatedEntity<T>::updateAnimation() {
     if (mAnimationTimer.isFinished()) {
         mAnimationTimer.stop();
 
-        if (mAnimationGID < mAnimationData.stopGID) {
-            mAnimationGID += sTilesetData.animationSize.x;
-            if (mAnimationGID / sTilesetData.srcCount.x != (mAnimationGID - sTilesetData.animationSize.x) / sTilesetData.srcCount.x) mAnimationGID += sTilesetData.srcCount.x * (sTilesetData.animationSize.y - 1);   // Originally intended for "flawed" tilesets where `sTilesetData.animationSize.x` > 'sTilesetData.srcCount.x`
+        if (mAnimationFrame + 1 < mAnimationData.frameCount) {
+            ++mAnimationFrame;
+            updateAnimationFrame(true);
         } else {
             if (mAnimation == Animation::kDeath) return;   // The real permanent
             if (tile::Data_EntityTileset::getContinuity(mAnimation)) resetAnimation(mAnimation);
             else resetAnimation(mBaseAnimation, BehaviouralType::kPrioritized);
         }
     }
-
-    mSrcRect.x = mAnimationGID % sTilesetData.srcCount.x * sTilesetData.srcSize.x;
-    mSrcRect.y = mAnimationGID / sTilesetData.srcCount.x * sTilesetData.srcSize.y;
 }
 
 /**
@@ -95,13 +89,28 @@ void AbstractAnimatedEntity<T>::resetAnimation(Animation animation, BehaviouralT
     if (flag != BehaviouralType::kPrioritized && tile::Data_EntityTileset::getPriority(animation) < tile::Data_EntityTileset::getPriority(mAnimation)) return; 
 
     mAnimation = animation;
-    mAnimationData = sTilesetData.at(mAnimation, sTilesetData.isMultiDirectional ? mDirection : tile::Data_EntityTileset::kDefaultDirection);
+    mAnimationData = sTilesetData->at(mAnimation, sTilesetData->isMultiDirectional ? mDirection : tile::Data_EntityTileset::kDefaultDirection);
 
-    mAnimationTimer.setMaxTicks(sTilesetData.animationTicks * mAnimationData.ticksMultiplier);
-
-    if (flag != BehaviouralType::kContinued) mAnimationGID = mAnimationData.startGID;
+    bool isEntered = flag != BehaviouralType::kContinued || mAnimationFrame >= mAnimationData.frameCount;
+    if (isEntered) mAnimationFrame = 0;
+    updateAnimationFrame(isEntered);
 }
 
+/**
+ * @brief Apply the `srcRect` and duration of the current frame.
+ * @param isEntered specifies whether the current frame has just been entered, in which case its tagged event, if any, is emitted into `tile::events`.
+ * @note Only `Player` and hostile entities are audible.
+*/
+template <typename T>
+void AbstractAnimatedEntity<T>::updateAnimationFrame(bool isEntered) {
+    auto frame = sTilesetData->getFrame(mAnimationData, mAnimationFrame); if (frame == nullptr) return;
+    mSrcRect = frame->srcRect;
+    mAnimationTimer.setMaxTicks(frame->ticks);
+
+    if constexpr (std::is_same_v<T, Player> || std::is_base_of_v<GenericHostileEntity<T>, T>) {
+        if (isEntered && frame->event != tile::Data_EntityTileset::Event::kNone) tile::events.push({ frame->event, mAnimation, std::is_same_v<T, Player> });
+    }
+}
 
 template class AbstractAnimatedEntity<Player>;
 
@@ -1,8 +1,10 @@
 #include <entities.hpp>
 
 #include <algorithm>
+#include <deque>
 #include <filesystem>
 #include <functional>
+#include <memory>
 #include <unordered_set>
 #include <type_traits>
 
@@ -16,47 +18,89 @@
 
 template <typename T>
 AbstractEntity<T>::AbstractEntity(SDL_Point const& destCoords) : mID(++sID_Counter), mDestCoords(destCoords), mDestRectModifier(config::entities::destRectModifier) {
-    mSrcRect.w = sTilesetData.srcSize.x * sTilesetData.animationSize.x;
-    mSrcRect.h = sTilesetData.srcSize.y * sTilesetData.animationSize.y;
+    mSrcRect.w = sTilesetData->srcSize.x * sTilesetData->animationSize.x;
+    mSrcRect.h = sTilesetData->srcSize.y * sTilesetData->animationSize.y;
 }
 
 /**
- * @see <utils.h> utils::loadTilesetsData
+ * @brief Acquire `sTilesetData` from `tile::cache`. Cheap if already acquired.
+ * @see <auxiliaries.hpp> tile::Data_EntityTilesetCache
 */
 template <typename T>
 void AbstractEntity<T>::initialize() {
-    pugi::xml_document document;
-    pugi::xml_parse_result result = document.load_file(sTilesetPath.c_str()); if (!result) return;   // Should be replaced with `result.status` or `pugi::xml_parse_status`
-    
-    sTilesetData.load(document, globals::renderer);
+    sTilesetData = tile::cache.get(sTilesetPath, globals::renderer);
 }
 
 template <typename T>
 void AbstractEntity<T>::deinitialize() {
-    sTilesetData.clear();
+    release();
     Multiton<T>::deinitialize();
+    sSpawnQueue.clear();
     sID_Counter = 0;
 }
 
+/**
+ * @brief Drop the reference to `sTilesetData`, allowing `tile::cache` to evict it.
+ * @note Recommended implementation: existing instances should be deinitialized beforehand.
+*/
+template <typename T>
+void AbstractEntity<T>::release() {
+    sTilesetData = std::make_shared<const tile::Data_EntityTileset>();
+}
+
 /**
  * @brief Change `sTilesetData`.
- * @note Experimental - only intended to use for `Player`, since undefined behaviour would occur on existing entities (that use old `sTilesetData`).
+ * @note Reduced to a pointer swap if the tileset at `path` has been loaded or prefetched before. The previous tileset remains cached.
 */
 template <typename T>
 void AbstractEntity<T>::reinitialize(std::filesystem::path path) {
-    sTilesetData.clear();
     sTilesetPath = path;
     AbstractEntity<T>::initialize();
 }
 
+/**
+ * @brief Materialize due spawn requests within the limits of `SpawnBudget`. Requests that do not fit are carried over to the next frame, in order.
+*/
+template <typename T>
+void AbstractEntity<T>::handleSpawnQueue() {
+    auto currTicks = globals::frameClock.getTicks();
+
+    while (!sSpawnQueue.empty() && sSpawnQueue.front().dueTicks <= currTicks && SpawnBudget::consume()) {
+        auto data = sSpawnQueue.front().data;
+        sSpawnQueue.pop_front();
+
+        auto instance = instantiate(data->destCoords);
+        instance->onLevelChange(*data);
+        instance->onWindowChange();
+    }
+}
 
 /**
- * @brief Render the current sprite to the window.
+ * @note Insert after any request with the same `dueTicks` to preserve insertion order.
+*/
+template <typename T>
+void AbstractEntity<T>::enqueueSpawn(level::Data_Generic* data, unsigned int dueTicks) {
+    auto it = std::upper_bound(sSpawnQueue.begin(), sSpawnQueue.end(), dueTicks, [](unsigned int dueTicks, Data_SpawnRequest const& request) { return dueTicks < request.dueTicks; });
+    sSpawnQueue.insert(it, { data, dueTicks });
+}
+
+
+/**
+ * @brief Submit the current sprite to `globals::renderQueue`, projected through `level::camera`. Sprites outside of the viewport are skipped.
  * @note Recommended implementation: this method requires `destRect` and `srcRect` to be set properly prior to being called.
+ * @note Sprites are sorted by `kRenderLayer<T>`, then by the bottom edge of `destRect`, hence the order in which types and instances are rendered does not matter.
 */
 template <typename T>
 void AbstractEntity<T>::render() const {
-    SDL_RenderCopyEx(globals::renderer, sTilesetData.texture, &mSrcRect, &mDestRect, mAngle, mCenter, mFlip);
+    if (!level::camera.isVisible(mDestRect)) return;
+
+    SpriteBatch::Data_Quad quad{ sTilesetData->texture, mSrcRect, level::camera.project(mDestRect), mFlip, mAngle };
+    if (mCenter != nullptr) {
+        quad.center = *mCenter;
+        quad.hasCenter = true;
+    }
+
+    globals::renderQueue.submit(quad, kRenderLayer<T>, quad.destRect.y + quad.destRect.h);
 }
 
 /**
@@ -91,11 +135,11 @@ template <typename T>
 SDL_Rect AbstractEntity<T>::getDestRectFromCoords(SDL_Point const& coords) const {
     return {
         coords.x * level::data.tileDestSize.x + utils::ftoi(mDestRectModifier.x * level::data.tileDestSize.x)
-        - (sTilesetData.animationSize.x - 1) / 2 * level::data.tileDestSize.x
-        - utils::ftoi(level::data.tileDestSize.x * sTilesetData.animationSize.x * (mDestRectModifier.w - 1) / 2),   // Apply `destRectModifier.x`, center `destRect` based on `tilesetData->animationSize.x` and `destRectModifier.w`
-        coords.y * level::data.tileDestSize.y + utils::ftoi(mDestRectModifier.y * level::data.tileDestSize.y) - (sTilesetData.animationSize.y - 1) / 2 * level::data.tileDestSize.y - utils::ftoi(level::data.tileDestSize.y * sTilesetData.animationSize.y * (mDestRectModifier.h - 1) / 2),   // Apply `destRectModifier.y`, center `destRect` based on `tilesetData->animationSize.y` and `destRectModifier.h`
-        utils::ftoi(level::data.tileDestSize.x * sTilesetData.animationSize.x * mDestRectModifier.w),
-        utils::ftoi(level::data.tileDestSize.y * sTilesetData.animationSize.y * mDestRectModifier.h),
+        - (sTilesetData->animationSize.x - 1) / 2 * level::data.tileDestSize.x
+        - utils::ftoi(level::data.tileDestSize.x * sTilesetData->animationSize.x * (mDestRectModifier.w - 1) / 2),   // Apply `destRectModifier.x`, center `destRect` based on `tilesetData->animationSize.x` and `destRectModifier.w`
+        coords.y * level::data.tileDestSize.y + utils::ftoi(mDestRectModifier.y * level::data.tileDestSize.y) - (sTilesetData->animationSize.y - 1) / 2 * level::data.tileDestSize.y - utils::ftoi(level::data.tileDestSize.y * sTilesetData->animationSize.y * (mDestRectModifier.h - 1) / 2),   // Apply `destRectModifier.y`, center `destRect` based on `tilesetData->animationSize.y` and `destRectModifier.h`
+        utils::ftoi(level::data.tileDestSize.x * sTilesetData->animationSize.x * mDestRectModifier.w),
+        utils::ftoi(level::data.tileDestSize.y * sTilesetData->animationSize.y * mDestRectModifier.h),
     };
 }
 
@@ -119,11 +163,35 @@ bool std::equal_to<AbstractEntity<T>>::operator()(AbstractEntity<T> const*& firs
 
 
 template <typename T>
-tile::Data_EntityTileset AbstractEntity<T>::sTilesetData;
+std::shared_ptr<const tile::Data_EntityTileset> AbstractEntity<T>::sTilesetData = std::make_shared<const tile::Data_EntityTileset>();
 
 template <typename T>
 int AbstractEntity<T>::sID_Counter = 0;
 
+template <typename T>
+std::deque<typename AbstractEntity<T>::Data_SpawnRequest> AbstractEntity<T>::sSpawnQueue;
+
+
+/**
+ * @brief Start a new frame: restore the spawn count and set the deadline.
+*/
+void SpawnBudget::reset() {
+    sCount = 0;
+    sDeadline = SDL_GetPerformanceCounter() + static_cast<Uint64>(config::entities::spawn::timeBudget * SDL_GetPerformanceFrequency() / 1000);
+}
+
+/**
+ * @return Whether another entity could be spawned within the current frame. Consumes one unit of the count budget if so.
+*/
+bool SpawnBudget::consume() {
+    if (sCount >= config::entities::spawn::countBudget || SDL_GetPerformanceCounter() >= sDeadline) return false;
+    ++sCount;
+    return true;
+}
+
+unsigned int SpawnBudget::sCount = 0;
+Uint64 SpawnBudget::sDeadline = 0;
+
 
 /**
  * @note Explicit Template Instantiation.
@@ -63,26 +63,29 @@ void GenericSurgeProjectile<T>::initiateAttack(ProjectileType type, SDL_Point co
             [[fallthrough]];
 
         case ProjectileType::kOrthogonalSingle:   // Also work with diagonals
-            instantiate(destCoords + direction, direction);   // Actual stuff
+            globals::commands.spawn<T>(destCoords + direction, direction);   // Actual stuff
             break;
 
         default: break;
     }
 }
 
+/**
+ * @note Called during iteration over `instances`, hence structural changes are deferred to `globals::commands`.
+*/
 template <typename T>
 void GenericSurgeProjectile<T>::handleInstantiation() {
     if (!isAnimationAtFinalSprite()) return;
 
     initiateNextLinearAttack();
-    globals::gc.insert(this);
+    globals::commands.despawn(static_cast<T*>(this));
 }
 
 template <typename T>
 void GenericSurgeProjectile<T>::initiateNextLinearAttack() {
     mNextDestCoords = new SDL_Point(mDestCoords + mDirection);
     if (!validateMove()) Mixer::invoke(&Mixer::playSFX, Mixer::SFXName::kSurgeAttack);
-    else instantiate(*mNextDestCoords, mDirection);
+    else globals::commands.spawn<T>(*mNextDestCoords, mDirection);
 }
 
 template <typename T>
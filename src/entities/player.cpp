@@ -1,12 +1,12 @@
 #include <entities.hpp>
 
 #include <filesystem>
+#include <memory>
 #include <unordered_map>
 
 #include <SDL.h>
 
 #include <timers.hpp>
-#include <mixer.hpp>
 #include <meta.hpp>
 #include <auxiliaries.hpp>
 
@@ -20,18 +20,37 @@ Player::Player(SDL_Point const& destCoords) : AbstractAnimatedDynamicEntity<Play
     mPrimaryStats = config::entities::player::primaryStats;
 }
 
+void Player::initialize() {
+    AbstractEntity<Player>::initialize();
+    prefetchAdjacentTilesets();
+}
+
 void Player::deinitialize() {
-    sTilesetData.clear();
+    sTilesetData = std::make_shared<const tile::Data_EntityTileset>();
     Singleton<Player>::deinitialize();
 }
 
+/**
+ * @brief Switch to the previous or next premade tileset. Cached tilesets are reused, hence rapid switching does not reload anything.
+*/
 void Player::reinitialize(bool increment) {
-    static unsigned short int index = 0;
     static const unsigned short int size = static_cast<unsigned short int>(sTilesetPaths.size());
 
-    if (increment) { if (index == size - 1) index = 0; else ++index; } else { if (!index) index = size - 1; else --index; }
+    if (increment) { if (sTilesetPathIndex == size - 1) sTilesetPathIndex = 0; else ++sTilesetPathIndex; } else { if (!sTilesetPathIndex) sTilesetPathIndex = size - 1; else --sTilesetPathIndex; }
+
+    AbstractAnimatedEntity<Player>::reinitialize(sTilesetPaths[sTilesetPathIndex]);
+    prefetchAdjacentTilesets();
+}
 
-    AbstractAnimatedEntity<Player>::reinitialize(sTilesetPaths[index]);
+/**
+ * @brief Prefetch the tilesets adjacent to the current one, so that the next switch in either direction is a pointer swap.
+*/
+void Player::prefetchAdjacentTilesets() {
+    if (!config::entities::player::prefetchAdjacentPaths || sTilesetPaths.empty()) return;
+
+    const auto size = sTilesetPaths.size();
+    tile::cache.prefetch(sTilesetPaths[(sTilesetPathIndex + 1) % size]);
+    tile::cache.prefetch(sTilesetPaths[(sTilesetPathIndex + size - 1) % size]);
 }
 
 void Player::onLevelChange(level::Data_Generic const& player) {
@@ -124,32 +143,6 @@ void Player::handleCustomEventGET(SDL_Event const& event) {
     }
 }
 
-void Player::handleSFX() const {
-    AbstractAnimatedDynamicEntity<Player>::handleSFX();
-
-    static constexpr int idleFrames = config::game::FPS >> 2;   // Magic number
-    static int idleFramesTracker = idleFrames;
-
-    if (idleFramesTracker) {
-        --idleFramesTracker;
-        return;
-    }
-
-    switch (mAnimation) {
-        case Animation::kWalk:
-            Mixer::invoke(&Mixer::playSFX, Mixer::SFXName::kPlayerWalk);
-            break;
-
-        case Animation::kRun:
-            Mixer::invoke(&Mixer::playSFX, Mixer::SFXName::kPlayerRun);
-            break;
-        
-        default: return;
-    }
-
-    idleFramesTracker = idleFrames;
-}
-
 void Player::handleKeyboardEvent_Movement(SDL_Event const& event) {
     static const std::unordered_map<SDL_Keycode, SDL_Point> mapping = {
         { ~config::Key::kPlayerMoveUp, { 0, -1 } },
@@ -304,4 +297,5 @@ const char* AbstractEntity<Player>::sTypeID = config::entities::player::typeID;
 template <>
 std::filesystem::path AbstractEntity<Player>::sTilesetPath = config::entities::player::path;
 
-const std::vector<std::filesystem::path> Player::sTilesetPaths = config::entities::player::paths;
\ No newline at end of file
+const std::vector<std::filesystem::path> Player::sTilesetPaths = config::entities::player::paths;
+unsigned short int Player::sTilesetPathIndex = 0;
@@ -27,12 +27,6 @@ Game::~Game() {
         SDL_FreeSurface(mWindowIcon);
         mWindowIcon = nullptr;
     }
-    if (mWindow != nullptr) {
-        SDL_DestroyWindow(mWindow);
-        mWindow = nullptr;
-    }
-
-    globals::deinitialize();
 
     FPSDisplayTimer::deinitialize();
     FPSControlTimer::deinitialize();
@@ -45,8 +39,16 @@ Game::~Game() {
     MenuInterface::deinitialize();
     LoadingInterface::deinitialize();
 
+    globals::fonts.clear();   // Prior to `TTF_Quit()`
     globals::gc.clear();
 
+    // Textures are released above, hence the renderer, then the window, must outlive them
+    globals::deinitialize();
+    if (mWindow != nullptr) {
+        SDL_DestroyWindow(mWindow);
+        mWindow = nullptr;
+    }
+
     // Quit SDL subsystems
     IMG_Quit();
     SDL_Quit();
@@ -83,6 +85,7 @@ void Game::initialize() {
     globals::renderer = SDL_CreateRenderer(mWindow, -1, mFlags.renderer);
 
     event::initialize();
+    globals::jobs.initialize(config::game::jobWorkerCount());
     
     // Initialize dependencies
     IngameInterface::initialize();
@@ -115,6 +118,10 @@ void Game::startGameLoop() {
     FPSDisplayTimer::invoke(&FPSDisplayTimer::start);
 
     while (globals::state != GameState::kExit) {
+        // Sample the clock once for the whole frame
+        globals::frameClock.tick();
+        globals::wheel.advance();
+
         // Control frame rate
         FPSControlTimer::invoke(&FPSControlTimer::start);
 
@@ -125,6 +132,7 @@ void Game::startGameLoop() {
         // Main flow
         handleDependencies();
         handleEvents();
+        globals::commands.apply();   // Sync point: spawns and despawns recorded during this frame take effect before rendering
         render();
 
         // Control frame rate
@@ -132,6 +140,9 @@ void Game::startGameLoop() {
 
         // Clean up
         globals::gc.clear();
+        globals::arena.reset();
+        SpriteBatch::endFrame();
+        RenderCommandBuffer::endFrame();
     }
 }
 
@@ -142,7 +153,7 @@ void Game::startGameLoop() {
  * @note Any `render()` methods should be placed here.
 */
 void Game::render() const {
-    SDL_RenderClear(globals::renderer);
+    globals::renderCommands.renderClear();
 
     switch (globals::state) {
         case GameState::kIngamePlaying:
@@ -169,6 +180,7 @@ void Game::render() const {
     FPSOverlay::invoke(&FPSOverlay::render);
     ExitText::invoke(&ExitText::render);
 
+    globals::batch.flush(globals::renderer);   // Should nothing else have flushed it, also submits `globals::renderCommands`
     SDL_RenderPresent(globals::renderer);
 }
 
@@ -342,8 +354,6 @@ void Game::handleCustomEventGET(SDL_Event const& event) const {
 
         default: break;
     }
-
-    event::terminate(event);
 }
 
 void Game::handleCustomEventPOST() const {
@@ -25,8 +25,8 @@ void GameOverInterface::render() const {
 }
 
 void GameOverInterface::renderBackground() const {
-    utils::setRendererDrawColor(globals::renderer, config::color::offblack);
-    SDL_RenderFillRect(globals::renderer, nullptr);
+    globals::renderCommands.setRenderDrawColor(config::color::offblack);
+    globals::renderCommands.renderFillRect();
 }
 
 void GameOverInterface::renderComponents() const {
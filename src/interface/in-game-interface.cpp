@@ -42,7 +42,7 @@ IngameInterface::IngameInterface() {
         // Projectiles
         PentacleProjectile::invoke(&PentacleProjectile::render);
 
-        // Player must be rendered last
+        // Player is submitted last, hence is drawn on top of entities of equal depth
         Player::invoke(&Player::render);
     };
 
@@ -93,37 +93,20 @@ void IngameInterface::deinitialize() {
     PentacleProjectile::deinitialize();
 
     IngameDialogueBox::deinitialize();
+
+    tile::cache.clear();
+    tile::atlas.clear();
 }
 
+/**
+ * @note Tilesets of level-specific entities are loaded on demand, upon the first level that references them.
+ * @see <entities.hpp> AbstractEntity<T>::onLevelChangeAll()
+*/
 void IngameInterface::initialize() {
     IngameMapHandler::initialize();
 
+    // Present on every level
     Player::initialize();
-
-    OmoriLightBulb::initialize();
-    OmoriKeysWASD::initialize();
-    HospitalXRayMachine::initialize();
-
-    PlaceholderInteractable::initialize();
-    OmoriMewO::initialize();
-    OmoriLaptop::initialize();
-    OmoriCat_0::initialize();
-    OmoriCat_1::initialize();
-    OmoriCat_2::initialize();
-    OmoriCat_3::initialize();
-    OmoriCat_4::initialize();
-    OmoriCat_5::initialize();
-    OmoriCat_6::initialize();
-    OmoriCat_7::initialize();
-    HospitalXRayScreenArm::initialize();
-    HospitalXRayScreenHead::initialize();
-    HospitalSink::initialize();
-
-    // PlaceholderTeleporter::initialize();
-    RedHandThrone::initialize();
-
-    Slime::initialize();
-
     PentacleProjectile::initialize();
 }
 
@@ -196,6 +179,10 @@ void IngameInterface::onLevelChange() const {
 
     PentacleProjectile::onLevelChangeAll();
 
+    tile::cache.trim(config::entities::tilesetMemoryBudget);   // Evict tilesets released above, if necessary
+    tile::events.clear();
+    globals::commands.clear();   // Pending spawns belong to the previous level
+
     Mixer::invoke(&Mixer::onLevelChange, IngameMapHandler::instance->getLevel());   // `IngameMapHandler::invoke(&IngameMapHandler::getLevel))` is not usable since the compiler cannot deduce "incomplete" type
 }
 
@@ -346,10 +333,11 @@ void IngameInterface::handleDependencies() const {
         case GameState::kIngamePlaying:
             handleEntitiesInteraction();
             handleLevelSpecifics();
-            handleEntitiesSFX();
             [[fallthrough]];
 
         case GameState::kIngameDialogue:
+            handleEntitiesAnimationEvents();
+            handleEntitiesSpawn();
             IngameDialogueBox::invoke(&IngameDialogueBox::updateProgress);
             IngameDialogueBox::invoke(&IngameDialogueBox::handleSFX);
             break;
@@ -362,21 +350,21 @@ void IngameInterface::handleDependencies() const {
  * @brief Handle all entities movements & animation updates.
 */
 void IngameInterface::handleEntitiesInteraction() const {
-    OmoriLightBulb::invoke(&OmoriLightBulb::updateAnimation);
-    OmoriKeysWASD::invoke(&OmoriKeysWASD::updateAnimation);
+    OmoriLightBulb::updateAnimationAll();
+    OmoriKeysWASD::updateAnimationAll();
     HospitalXRayMachine::invoke(&HospitalXRayMachine::updateAnimation);
 
     PlaceholderInteractable::invoke(&PlaceholderInteractable::updateAnimation);
     OmoriLaptop::invoke(&OmoriLaptop::updateAnimation);
     OmoriMewO::invoke(&OmoriMewO::updateAnimation);
-    OmoriCat_0::invoke(&OmoriCat_0::updateAnimation);
-    OmoriCat_1::invoke(&OmoriCat_1::updateAnimation);
-    OmoriCat_2::invoke(&OmoriCat_2::updateAnimation);
-    OmoriCat_3::invoke(&OmoriCat_3::updateAnimation);
-    OmoriCat_4::invoke(&OmoriCat_4::updateAnimation);
-    OmoriCat_5::invoke(&OmoriCat_5::updateAnimation);
-    OmoriCat_6::invoke(&OmoriCat_6::updateAnimation);
-    OmoriCat_7::invoke(&OmoriCat_7::updateAnimation);
+    OmoriCat_0::updateAnimationAll();
+    OmoriCat_1::updateAnimationAll();
+    OmoriCat_2::updateAnimationAll();
+    OmoriCat_3::updateAnimationAll();
+    OmoriCat_4::updateAnimationAll();
+    OmoriCat_5::updateAnimationAll();
+    OmoriCat_6::updateAnimationAll();
+    OmoriCat_7::updateAnimationAll();
     HospitalXRayScreenArm::invoke(&HospitalXRayScreenArm::updateAnimation);
     HospitalXRayScreenHead::invoke(&HospitalXRayScreenHead::updateAnimation);
     HospitalSink::invoke(&HospitalSink::updateAnimation);
@@ -384,11 +372,12 @@ void IngameInterface::handleEntitiesInteraction() const {
     // PlaceholderTeleporter::invoke(&PlaceholderTeleporter::updateAnimation);
     RedHandThrone::invoke(&RedHandThrone::updateAnimation);
 
-    Slime::invoke(&Slime::move);
-    Slime::invoke(&Slime::updateAnimation);
+    // Per-entity updates that only read shared state, fanned out across `globals::jobs`
+    Slime::invokeParallel(&Slime::move);
+    Slime::invokeParallel(&Slime::updateAnimation);
 
-    PentacleProjectile::invoke(&PentacleProjectile::handleInstantiation);
-    PentacleProjectile::invoke(&PentacleProjectile::updateAnimation);
+    PentacleProjectile::invoke(&PentacleProjectile::handleInstantiation);   // Might play SFX
+    PentacleProjectile::invokeParallel(&PentacleProjectile::updateAnimation);
 
     Player::invoke(&Player::move);
     Player::invoke(&Player::updateAnimation);
@@ -432,10 +421,55 @@ void IngameInterface::handleLevelSpecifics() const {
     }
 }
 
-void IngameInterface::handleEntitiesSFX() const {
-    Player::invoke(&Player::handleSFX);
-    // Teleporter::invoke(&Teleporter::handleSFX);
-    Slime::invoke(&Slime::handleSFX);
+/**
+ * @brief Drain `tile::events`, playing the associated SFX.
+ * @note Events emitted during `GameState::kIngameDialogue` are discarded. Each SFX is played at most once per frame.
+*/
+void IngameInterface::handleEntitiesAnimationEvents() const {
+    using Event = tile::Data_EntityTileset::Event;
+    std::array<bool, static_cast<std::size_t>(Mixer::SFXName::kPlayerDeath) + 1> isPlayed{};
+
+    while (auto event = tile::events.pop()) {
+        if (globals::state != GameState::kIngamePlaying) continue;
+
+        std::optional<Mixer::SFXName> SFXName;
+        switch (event->event) {
+            case Event::kFootstep:
+                if (event->isPlayerSource) SFXName = event->animation == Animation::kRun ? Mixer::SFXName::kPlayerRun : Mixer::SFXName::kPlayerWalk;
+                break;
+
+            case Event::kAttack:
+                SFXName = event->isPlayerSource ? Mixer::SFXName::kPlayerAttack : Mixer::SFXName::kEntityAttack;
+                break;
+
+            case Event::kDamaged:
+                SFXName = Mixer::SFXName::kEntityDamaged;
+                break;
+
+            case Event::kDeath:
+                SFXName = event->isPlayerSource ? Mixer::SFXName::kPlayerDeath : Mixer::SFXName::kEntityDeath;
+                break;
+
+            default: break;
+        }
+
+        if (!SFXName.has_value() || isPlayed[static_cast<std::size_t>(SFXName.value())]) continue;
+        isPlayed[static_cast<std::size_t>(SFXName.value())] = true;
+        Mixer::invoke(&Mixer::playSFX, SFXName.value());
+    }
+}
+
+/**
+ * @brief Materialize pending spawn requests, within a per-frame budget shared by all entity types.
+ * @note Only types instantiated via `instantiateEx()` are required here.
+*/
+void IngameInterface::handleEntitiesSpawn() const {
+    SpawnBudget::reset();
+
+    PlaceholderTeleporter::handleSpawnQueue();
+    RedHandThrone::handleSpawnQueue();
+
+    Slime::handleSpawnQueue();
 }
 
 template <event::Code C>
@@ -652,7 +686,7 @@ IngameInterface::handleLevelSpecifics_impl() const {
                             "... (Like, really?)",
                         });
 
-                        std::vector<level::Data_Generic*> instantiationData;
+                        std::pmr::vector<level::Data_Generic*> instantiationData(&globals::arena);
                         for (int y = 66; y <= 74; ++y) for (int x = 2; x <= 8; ++x) instantiationData.push_back(new level::Data_Generic({ x, y }));
                         Slime::instantiateEx(instantiationData);
 
@@ -746,7 +780,7 @@ template <level::Name L>
 typename std::enable_if_t<L == level::Name::kLevelForest_0>
 IngameInterface::handleLevelSpecifics_impl() const {
     if (PlaceholderTeleporter::instances.empty()) {
-        std::vector<level::Data_Generic*> data;
+        std::pmr::vector<level::Data_Generic*> data(&globals::arena);
         for (int y = 4; y <= 18; ++y) data.push_back(new level::Data_Teleporter(
             { 49, y }, { 1, y }, level::Name::kLevelForest_1
         ));
@@ -758,7 +792,7 @@ template <level::Name L>
 typename std::enable_if_t<L == level::Name::kLevelForest_1>
 IngameInterface::handleLevelSpecifics_impl() const {
     if (PlaceholderTeleporter::instances.empty()) {
-        std::vector<level::Data_Generic*> data;
+        std::pmr::vector<level::Data_Generic*> data(&globals::arena);
         for (int y = 4; y <= 18; ++y) {
             data.push_back(new level::Data_Teleporter( { 0, y }, { 48, y }, level::Name::kLevelForest_0 ));
             data.push_back(new level::Data_Teleporter( { 49, y }, { 1, y }, level::Name::kLevelForest_2 ));
@@ -771,7 +805,7 @@ template <level::Name L>
 typename std::enable_if_t<L == level::Name::kLevelForest_2>
 IngameInterface::handleLevelSpecifics_impl() const {
     if (PlaceholderTeleporter::instances.empty()) {
-        std::vector<level::Data_Generic*> data;
+        std::pmr::vector<level::Data_Generic*> data(&globals::arena);
         for (int y = 4; y <= 18; ++y) {
             data.push_back(new level::Data_Teleporter( { 0, y }, { 48, y }, level::Name::kLevelForest_1 ));
             data.push_back(new level::Data_Teleporter( { 49, y }, { 1, y }, level::Name::kLevelForest_3 ));
@@ -784,7 +818,7 @@ template <level::Name L>
 typename std::enable_if_t<L == level::Name::kLevelForest_3>
 IngameInterface::handleLevelSpecifics_impl() const {
     if (PlaceholderTeleporter::instances.empty()) {
-        std::vector<level::Data_Generic*> data;
+        std::pmr::vector<level::Data_Generic*> data(&globals::arena);
         for (int y = 4; y <= 18; ++y) {
             data.push_back(new level::Data_Teleporter( { 0, y }, { 48, y }, level::Name::kLevelForest_2 ));
             data.push_back(new level::Data_Teleporter( { 49, y }, { 1, y }, level::Name::kLevelForest_4 ));
@@ -797,7 +831,7 @@ template <level::Name L>
 typename std::enable_if_t<L == level::Name::kLevelForest_4>
 IngameInterface::handleLevelSpecifics_impl() const {
     if (PlaceholderTeleporter::instances.empty()) {
-        std::vector<level::Data_Generic*> data;
+        std::pmr::vector<level::Data_Generic*> data(&globals::arena);
         for (int y = 4; y <= 18; ++y) data.push_back(new level::Data_Teleporter(
             { 0, y }, { 48, y }, level::Name::kLevelForest_3
         ));
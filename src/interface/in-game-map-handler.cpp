@@ -1,20 +1,21 @@
 #include <interface.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <filesystem>
 #include <vector>
 
 #include <SDL.h>
 
 #include <auxiliaries.hpp>
+#include <pixel-kernels.hpp>
+#include <timers.hpp>
 
 
 IngameMapHandler::IngameMapHandler(const level::Name levelName) : AbstractInterface<IngameMapHandler>(), mLevelName(levelName) {}
 
 IngameMapHandler::~IngameMapHandler() {
-    if (mGrayscaleTexture != nullptr) {
-        SDL_DestroyTexture(mGrayscaleTexture);
-        mGrayscaleTexture = nullptr;
-    }
+    clearChunks();
 }
 
 void IngameMapHandler::initialize() {
@@ -23,32 +24,82 @@ void IngameMapHandler::initialize() {
     sLevelMap.load(data);
 }
 
+/**
+ * @brief Render chunks overlapping the viewport of `level::camera`, baking those not yet baked. Chunks approaching the viewport are baked ahead of time.
+ * @note Map memory is therefore bounded by the size of the window rather than that of the level.
+ * @note Dirty tiles of a chunk are re-composited only once the chunk is drawn, hence changes to chunks out of view cost nothing until they come into view.
+*/
 void IngameMapHandler::render() const {
-    SDL_RenderCopy(globals::renderer, isOnGrayscale ? mGrayscaleTexture : mTexture, nullptr, nullptr);
+    if (!mChunkCount.x || !mChunkCount.y) return;
+    ++mAccessCounter;
+
+    updateAnimatedTiles();
+
+    auto const& viewport = level::camera.viewport;
+
+    auto getChunkRange = [&](int margin) {
+        return SDL_Rect{
+            std::max(viewport.x / mChunkSize.x - margin, 0),
+            std::max(viewport.y / mChunkSize.y - margin, 0),
+            std::min((viewport.x + viewport.w - 1) / mChunkSize.x + margin, mChunkCount.x - 1),
+            std::min((viewport.y + viewport.h - 1) / mChunkSize.y + margin, mChunkCount.y - 1),
+        };   // `w` and `h` denote the inclusive upper bounds
+    };
+
+    auto visibleRange = getChunkRange(0);
+    for (int y = visibleRange.y; y <= visibleRange.h; ++y) for (int x = visibleRange.x; x <= visibleRange.w; ++x) {
+        auto& chunk = getChunk({ x, y });
+        if (!isOnGrayscale || chunk.grayscaleTexture == chunk.texture) { if (chunk.dirtyTiles.any()) recompositeChunk(chunk, false); }
+        if (isOnGrayscale) {
+            if (chunk.grayscaleTexture == nullptr) bakeGrayscaleChunk(chunk);
+            else if (chunk.grayscaleDirtyTiles.any()) recompositeChunk(chunk, true);
+        }
+
+        auto texture = isOnGrayscale ? chunk.grayscaleTexture : chunk.texture;
+        globals::batch.draw(texture, { 0, 0, chunk.destRect.w, chunk.destRect.h }, level::camera.project(chunk.destRect), config::batch::mapLayer);
+    }
+
+    // Amortize baking over multiple frames
+    auto prefetchRange = getChunkRange(config::interface::mapChunkPrefetchMargin);
+    int prefetchCount = config::interface::mapChunkPrefetchCount;
+    for (int y = prefetchRange.y; y <= prefetchRange.h; ++y) for (int x = prefetchRange.x; x <= prefetchRange.w; ++x) {
+        auto it = mChunks.find(y * mChunkCount.x + x);
+        if (it != mChunks.end()) it->second.lastAccess = mAccessCounter;
+        else if (prefetchCount-- > 0) getChunk({ x, y });
+    }
+
+    trimChunks(config::interface::mapChunkMemoryBudget);
 }
 
 /**
- * @brief Populate `level` members and re-render `texture`.
- * @note The `grayscaleTexture` block must be at THAT exact location i.e. before resetting render-target else undefined behaviour would be encountered.
+ * @brief Populate `level` members and discard chunks of the previous level.
 */
 void IngameMapHandler::onLevelChange() {
     loadLevel();
+    clearChunks();
+    loadAnimatedTiles();
 
-    if (mTexture != nullptr) SDL_DestroyTexture(mTexture);
     mTextureSize = {
         level::data.tileDestCount.x * level::data.tileDestSize.x,
         level::data.tileDestCount.y * level::data.tileDestSize.y,
     };
-
-    mTexture = SDL_CreateTexture(globals::renderer, SDL_PixelFormatEnum::SDL_PIXELFORMAT_RGBA32, SDL_TextureAccess::SDL_TEXTUREACCESS_TARGET | SDL_TextureAccess::SDL_TEXTUREACCESS_STATIC, mTextureSize.x, mTextureSize.y);
-
-    renderToTexture();
+    mChunkSize = {
+        config::interface::mapChunkTileCount * level::data.tileDestSize.x,
+        config::interface::mapChunkTileCount * level::data.tileDestSize.y,
+    };
+    mChunkCount = {
+        (level::data.tileDestCount.x + config::interface::mapChunkTileCount - 1) / config::interface::mapChunkTileCount,
+        (level::data.tileDestCount.y + config::interface::mapChunkTileCount - 1) / config::interface::mapChunkTileCount,
+    };
 }
 
+/**
+ * @note Chunks are re-baked on demand rather than all at once.
+*/
 void IngameMapHandler::onWindowChange() {
     #if defined(_WIN64) || defined(_WIN32) || defined(_WIN16)
-    // Weird windows-specific bug, don't know how to fix, temporary patch adversely affects performance (which scales proportionally with level size)
-    renderToTexture();
+    // Weird windows-specific bug, don't know how to fix, temporary patch
+    clearChunks();
     #endif
 }
 
@@ -71,6 +122,46 @@ void IngameMapHandler::changeLevel(const level::Name levelName_) {
     onLevelChange();
 }
 
+/**
+ * @brief Replace the GID at `layer` of the tile at `tileCoords`, then invalidate that tile only.
+*/
+void IngameMapHandler::setTile(SDL_Point const& tileCoords, std::size_t layer, tile::GID gid) {
+    if (tileCoords.x < 0 || tileCoords.y < 0 || tileCoords.x >= level::data.tileDestCount.x || tileCoords.y >= level::data.tileDestCount.y) return;
+
+    auto& GIDs = level::data.tiles[tileCoords.y][tileCoords.x];
+    if (layer >= GIDs.size() || GIDs[layer] == gid) return;
+
+    const auto prevGID = GIDs[layer];
+    GIDs[layer] = gid;
+    level::data.loadDrawList({ tileCoords.x / config::interface::mapChunkTileCount, tileCoords.y / config::interface::mapChunkTileCount });
+
+    if (std::find(GIDs.begin(), GIDs.end(), prevGID) == GIDs.end()) unregisterAnimatedTile(prevGID, tileCoords);   // Unless still held by another layer
+    registerAnimatedTile(gid, tileCoords);
+    invalidate({ tileCoords.x, tileCoords.y, 1, 1 });
+}
+
+/**
+ * @brief Mark tiles within `tileRect` of baked chunks as dirty. Chunks not yet baked need not be marked, since they are baked from up-to-date data anyway.
+ * @param tileRect in tile coordinates.
+ * @note Costs `O(tileRect.w * tileRect.h)`, regardless of the size of the level.
+*/
+void IngameMapHandler::invalidate(SDL_Rect const& tileRect) const {
+    constexpr int N = config::interface::mapChunkTileCount;
+
+    const int left = std::max(tileRect.x, 0), right = std::min(tileRect.x + tileRect.w, level::data.tileDestCount.x);
+    const int top = std::max(tileRect.y, 0), bottom = std::min(tileRect.y + tileRect.h, level::data.tileDestCount.y);
+
+    for (int y = top; y < bottom; ++y) for (int x = left; x < right; ++x) {
+        auto it = mChunks.find(y / N * mChunkCount.x + x / N);
+        if (it == mChunks.end()) continue;
+
+        auto& chunk = it->second;
+        const auto bit = y % N * N + x % N;
+        chunk.dirtyTiles.set(bit);
+        if (chunk.grayscaleTexture != nullptr && chunk.grayscaleTexture != chunk.texture) chunk.grayscaleDirtyTiles.set(bit);
+    }
+}
+
 /**
  * @brief Populate `level` members with relevant data.
  * @note Should be called once during initialization or whenever `level` changes.
@@ -84,78 +175,303 @@ void IngameMapHandler::loadLevel() const {
     level::data.load(JSONLevelData);
 }
 
-void IngameMapHandler::renderToTexture() {
-    auto cachedRenderTarget = SDL_GetRenderTarget(globals::renderer);
-    SDL_SetRenderTarget(globals::renderer, mTexture);
-    SDL_RenderClear(globals::renderer);
+/**
+ * @brief Retrieve the chunk at `chunkCoords`, baking it if not already baked.
+*/
+IngameMapHandler::Data_Chunk& IngameMapHandler::getChunk(SDL_Point const& chunkCoords) const {
+    auto [it, isInserted] = mChunks.try_emplace(chunkCoords.y * mChunkCount.x + chunkCoords.x);
+    auto& chunk = it->second;
+    chunk.lastAccess = mAccessCounter;
+    if (!isInserted) return chunk;
+
+    chunk.destRect = {
+        chunkCoords.x * mChunkSize.x,
+        chunkCoords.y * mChunkSize.y,
+        std::min(mChunkSize.x, mTextureSize.x - chunkCoords.x * mChunkSize.x),
+        std::min(mChunkSize.y, mTextureSize.y - chunkCoords.y * mChunkSize.y),
+    };
+    bakeChunk(chunk);
 
-    renderBackground();
-    renderLevelTilelayers();
+    return chunk;
+}
+
+/**
+ * @brief Render the static portions of the level covered by `chunk` to its texture.
+ * @note The grayscaled variant is not baked here, but upon its first request.
+ * @note Quads already queued into `globals::batch` belong to the previous render target, hence are flushed beforehand.
+*/
+void IngameMapHandler::bakeChunk(Data_Chunk& chunk) const {
+    chunk.texture = SDL_CreateTexture(globals::renderer, SDL_PixelFormatEnum::SDL_PIXELFORMAT_RGBA32, SDL_TextureAccess::SDL_TEXTUREACCESS_TARGET, chunk.destRect.w, chunk.destRect.h);
 
-    if (mGrayscaleTexture != nullptr) SDL_DestroyTexture(mGrayscaleTexture);
-    mGrayscaleTexture = utils::createGrayscaleTexture(globals::renderer, mTexture, config::interface::grayscaleIntensity);
+    globals::batch.flush(globals::renderer);
+    auto cachedRenderTarget = globals::renderCommands.getRenderTarget();
+    globals::renderCommands.setRenderTarget(chunk.texture);
+    globals::renderCommands.renderClear();
 
-    SDL_SetRenderTarget(globals::renderer, cachedRenderTarget);
+    renderBackground(level::data.backgroundColor);
+    renderChunkTilelayers(chunk);
+    globals::batch.flush(globals::renderer);
+
+    globals::renderCommands.setRenderTarget(cachedRenderTarget);
+
+    chunk.dirtyTiles.reset();
+    chunk.textureMemory = utils::getTextureMemory(chunk.texture);
+    mChunkMemory += chunk.textureMemory;
 }
 
 /**
- * @brief Fill the window with the tileset's black to achieve a seamless feel.
+ * @brief Render the grayscaled variant of `chunk` from grayscaled copies of the level's tilesets, which are themselves converted on the CPU upon the first request of the level.
+ * @note Falls back to reading back `chunk.texture` via `utils::createGrayscaleTexture()` should a tileset image fail to load.
 */
-void IngameMapHandler::renderBackground() const {
-    utils::setRendererDrawColor(globals::renderer, level::data.backgroundColor);
-    SDL_RenderFillRect(globals::renderer, nullptr);
+void IngameMapHandler::bakeGrayscaleChunk(Data_Chunk& chunk) const {
+    const auto intensity = getGrayscaleIntensity();
+    chunk.grayscaleDirtyTiles.reset();
+    if (!intensity) {
+        chunk.grayscaleTexture = chunk.texture;
+        return;
+    }
+
+    globals::batch.flush(globals::renderer);
+    auto cachedRenderTarget = globals::renderCommands.getRenderTarget();
+
+    if (level::data.tilesets.loadGrayscale(globals::renderer, intensity)) {
+        chunk.grayscaleTexture = SDL_CreateTexture(globals::renderer, SDL_PixelFormatEnum::SDL_PIXELFORMAT_RGBA32, SDL_TextureAccess::SDL_TEXTUREACCESS_TARGET, chunk.destRect.w, chunk.destRect.h);
+        globals::renderCommands.setRenderTarget(chunk.grayscaleTexture);
+        globals::renderCommands.renderClear();
+
+        renderBackground(pixel::grayscale(level::data.backgroundColor, intensity));
+        renderChunkTilelayers(chunk, true);
+        globals::batch.flush(globals::renderer);
+    } else {
+        if (chunk.dirtyTiles.any()) recompositeChunk(chunk, false);
+
+        // Read pixels from `chunk.texture`, hence it must be the render target at THAT exact location
+        globals::renderCommands.setRenderTarget(chunk.texture);
+        globals::renderCommands.submit(globals::renderer);
+        chunk.grayscaleTexture = utils::createGrayscaleTexture(globals::renderer, chunk.texture, config::interface::grayscaleIntensity);
+    }
+
+    globals::renderCommands.setRenderTarget(cachedRenderTarget);
+
+    if (chunk.grayscaleTexture == chunk.texture) return;
+    auto textureMemory = utils::getTextureMemory(chunk.grayscaleTexture);
+    chunk.textureMemory += textureMemory;
+    mChunkMemory += textureMemory;
 }
 
 /**
- * @brief Render the static portions of a level to `texture`.
+ * @brief Re-composite the dirty tiles of `chunk` onto `texture`, or onto `grayscaleTexture` if `isGrayscale` is set.
+ * @note Each horizontal run of dirty tiles is cleared to the background color, then every tilelayer is redrawn over dirty tiles only. Dirty tiles are redrawn exactly once, hence semi-transparent tiles are never blended twice.
 */
-void IngameMapHandler::renderLevelTilelayers() const {
-    SDL_Rect GID_SrcRect, GID_DestRect;
-    SDL_Texture* GID_Texture = nullptr;   // Assign-only
+void IngameMapHandler::recompositeChunk(Data_Chunk& chunk, bool isGrayscale) const {
+    constexpr int N = config::interface::mapChunkTileCount;
+    const auto intensity = getGrayscaleIntensity();
+
+    if (isGrayscale && !level::data.tilesets.loadGrayscale(globals::renderer, intensity)) {
+        // Baked via readback, which cannot be done partially
+        releaseGrayscaleChunk(chunk);
+        bakeGrayscaleChunk(chunk);
+        return;
+    }
 
-    utils::LRUCache<tile::GID, tile::Data_TilelayerTileset> cache(config::interface::LRUCacheSize);   // Aims to reduce the number of calls to `Data_TilelayerTilesets::operator[]` which is essentially `std::lower_bound` which is `O(log(n))` time complexity
+    auto& dirtyTiles = isGrayscale ? chunk.grayscaleDirtyTiles : chunk.dirtyTiles;
+    const auto tileRect = getTileRect(chunk);
 
-    GID_DestRect.x = GID_DestRect.y = 0;
-    GID_DestRect.w = level::data.tileDestSize.x;
-    GID_DestRect.h = level::data.tileDestSize.y;
+    globals::batch.flush(globals::renderer);
+    auto cachedRenderTarget = globals::renderCommands.getRenderTarget();
+    globals::renderCommands.setRenderTarget(isGrayscale ? chunk.grayscaleTexture : chunk.texture);
+    globals::renderCommands.setRenderDrawColor(isGrayscale ? pixel::grayscale(level::data.backgroundColor, intensity) : level::data.backgroundColor);
 
-    tile::Data_TilelayerTileset tilesetData;
+    for (int y = 0; y < tileRect.h; ++y) {
+        for (int x = 0; x < tileRect.w;) {
+            if (!dirtyTiles.test(y * N + x)) { ++x; continue; }
 
-    for (int y = 0; y < level::data.tileDestCount.y; ++y) {
-        for (int x = 0; x < level::data.tileDestCount.x; ++x) {
-            for (const auto& gid : level::data.tiles[y][x]) {
-                if (!gid) continue;   // A GID value of `0` represents an "empty" tile i.e. associated with no tileset
+            int end = x + 1;
+            while (end < tileRect.w && dirtyTiles.test(y * N + end)) ++end;
 
-                auto cache_result = cache.at(gid);   // O(1) time complexity
+            SDL_Rect destRect = { x * level::data.tileDestSize.x, y * level::data.tileDestSize.y, (end - x) * level::data.tileDestSize.x, level::data.tileDestSize.y };
+            globals::renderCommands.renderFillRect(&destRect);
 
-                if (!cache_result.has_value()) {   // GID not recently used
-                    auto tilesetData_o = level::data.tilesets[gid];   // O(log(n)) time complexity
-                    if (!tilesetData_o.has_value()) continue;   // GID is invalid
-                    tilesetData = tilesetData_o.value();
-                    cache.insert(gid, tilesetData);   // Store to cache
-                } else tilesetData = cache_result.value();   // O(1) time complexity
+            x = end;
+        }
+    }
 
-                if (tilesetData.getProperty("norender") == "true") continue;   // GID is for non-render purposes e.g. collision
+    renderChunkTilelayers(chunk, isGrayscale, &dirtyTiles);
 
-                GID_Texture = tilesetData.texture;
-                GID_SrcRect = {
-                    ((gid - tilesetData.firstGID) % tilesetData.srcCount.x) * tilesetData.srcSize.x,
-                    ((gid - tilesetData.firstGID) / tilesetData.srcCount.x) * tilesetData.srcSize.y,
-                    tilesetData.srcSize.x,
-                    tilesetData.srcSize.y,
-                };
+    globals::batch.flush(globals::renderer);
+    globals::renderCommands.setRenderTarget(cachedRenderTarget);
 
-                SDL_RenderCopy(globals::renderer, GID_Texture, &GID_SrcRect, &GID_DestRect);
-            }
+    dirtyTiles.reset();
+}
 
-            GID_DestRect.x += GID_DestRect.w;
+void IngameMapHandler::releaseGrayscaleChunk(Data_Chunk& chunk) const {
+    if (chunk.grayscaleTexture != nullptr && chunk.grayscaleTexture != chunk.texture) {
+        auto textureMemory = utils::getTextureMemory(chunk.grayscaleTexture);
+        chunk.textureMemory -= textureMemory;
+        mChunkMemory -= textureMemory;
+        SDL_DestroyTexture(chunk.grayscaleTexture);
+    }
+
+    chunk.grayscaleTexture = nullptr;
+    chunk.grayscaleDirtyTiles.reset();
+}
+
+/**
+ * @return The range of tiles covered by `chunk`, in tile coordinates.
+*/
+SDL_Rect IngameMapHandler::getTileRect(Data_Chunk const& chunk) const {
+    return {
+        chunk.destRect.x / level::data.tileDestSize.x,
+        chunk.destRect.y / level::data.tileDestSize.y,
+        chunk.destRect.w / level::data.tileDestSize.x,
+        chunk.destRect.h / level::data.tileDestSize.y,
+    };
+}
+
+/**
+ * @brief Evict chunks not accessed during the current frame in least-recently-used order, until the total texture memory no longer exceeds `budget`.
+*/
+void IngameMapHandler::trimChunks(std::size_t budget) const {
+    while (mChunkMemory > budget) {
+        auto victim = mChunks.end();
+        for (auto it = mChunks.begin(); it != mChunks.end(); ++it) {
+            if (it->second.lastAccess == mAccessCounter) continue;
+            if (victim == mChunks.end() || it->second.lastAccess < victim->second.lastAccess) victim = it;
         }
+        if (victim == mChunks.end()) return;   // Every remaining chunk is in use
+
+        mChunkMemory -= victim->second.textureMemory;
+        if (victim->second.grayscaleTexture != nullptr && victim->second.grayscaleTexture != victim->second.texture) SDL_DestroyTexture(victim->second.grayscaleTexture);
+        SDL_DestroyTexture(victim->second.texture);
+        mChunks.erase(victim);
+    }
+}
+
+void IngameMapHandler::clearChunks() const {
+    for (auto& [index, chunk] : mChunks) {
+        if (chunk.grayscaleTexture != nullptr && chunk.grayscaleTexture != chunk.texture) SDL_DestroyTexture(chunk.grayscaleTexture);
+        SDL_DestroyTexture(chunk.texture);
+    }
+
+    mChunks.clear();
+    mChunkMemory = 0;
+}
+
+/**
+ * @brief Collect every occurrence of an animated GID within the level.
+ * @note Called once per level; animated tiles are typically few, hence the scan is the only cost proportional to the size of the level.
+*/
+void IngameMapHandler::loadAnimatedTiles() {
+    mAnimatedTiles.clear();
+    if (level::data.tilesets.getAnimations().empty()) return;
+
+    for (int y = 0; y < level::data.tileDestCount.y; ++y) for (int x = 0; x < level::data.tileDestCount.x; ++x) {
+        for (auto gid : level::data.tiles[y][x]) if (gid) registerAnimatedTile(gid, { x, y });
+    }
+}
+
+/**
+ * @brief Register `tileCoords` as an occurrence of `gid`, if animated and not already registered.
+*/
+void IngameMapHandler::registerAnimatedTile(tile::GID gid, SDL_Point const& tileCoords) {
+    auto const& animations = level::data.tilesets.getAnimations();
+    auto animation = animations.find(gid); if (animation == animations.end()) return;
+
+    auto [it, isInserted] = mAnimatedTiles.try_emplace(gid);
+    if (isInserted) {
+        it->second.animation = &animation->second;
+        it->second.currGID = animation->second.getFrame(globals::frameClock.getTicks());
+    }
+
+    auto& occurrences = it->second.tileCoords;
+    if (std::none_of(occurrences.begin(), occurrences.end(), [&](SDL_Point const& coords) { return coords.x == tileCoords.x && coords.y == tileCoords.y; })) occurrences.push_back(tileCoords);
+}
 
-        GID_DestRect.x = 0;
-        GID_DestRect.y += GID_DestRect.h;
+/**
+ * @brief Remove `tileCoords` from the occurrences of `gid`, dropping `gid` altogether once it has none left.
+ * @note Occurrences are unordered, hence the removed one is swapped with the last.
+*/
+void IngameMapHandler::unregisterAnimatedTile(tile::GID gid, SDL_Point const& tileCoords) {
+    auto it = mAnimatedTiles.find(gid); if (it == mAnimatedTiles.end()) return;
+
+    auto& occurrences = it->second.tileCoords;
+    auto occurrence = std::find_if(occurrences.begin(), occurrences.end(), [&](SDL_Point const& coords) { return coords.x == tileCoords.x && coords.y == tileCoords.y; });
+    if (occurrence == occurrences.end()) return;
+
+    *occurrence = occurrences.back();
+    occurrences.pop_back();
+    if (occurrences.empty()) mAnimatedTiles.erase(it);
+}
+
+/**
+ * @brief Advance animated tiles along in-game time, invalidating the occurrences of those whose frame changed.
+*/
+void IngameMapHandler::updateAnimatedTiles() const {
+    const auto ticks = globals::frameClock.getTicks();
+
+    for (auto& [gid, animatedTile] : mAnimatedTiles) {
+        auto currGID = animatedTile.animation->getFrame(ticks);
+        if (currGID == animatedTile.currGID) continue;
+
+        animatedTile.currGID = currGID;
+        for (auto const& tileCoords : animatedTile.tileCoords) invalidate({ tileCoords.x, tileCoords.y, 1, 1 });
     }
+}
 
-    cache.clear();
+/**
+ * @return The frame currently displayed in lieu of `gid`, or `gid` itself if it is not animated.
+*/
+tile::GID IngameMapHandler::resolveAnimatedTile(tile::GID gid) const {
+    if (mAnimatedTiles.empty()) return gid;
+
+    auto it = mAnimatedTiles.find(gid);
+    return it != mAnimatedTiles.end() ? it->second.currGID : gid;
+}
+
+unsigned int IngameMapHandler::getGrayscaleIntensity() {
+    return static_cast<unsigned int>(std::lround(std::clamp<double>(config::interface::grayscaleIntensity, 0.0, 1.0) * 256));
+}
+
+/**
+ * @brief Fill the window with the tileset's black to achieve a seamless feel.
+*/
+void IngameMapHandler::renderBackground(SDL_Color const& color) const {
+    globals::renderCommands.setRenderDrawColor(color);
+    globals::renderCommands.renderFillRect();
+}
+
+/**
+ * @brief Replay the draw lists of `chunk`, in tilelayer order, relative to the top-left corner of `chunk`.
+ * @param isGrayscale whether to sample the grayscaled copies of the tilesets instead. Requires `level::data.tilesets.loadGrayscale()` to have succeeded.
+ * @param mask if provided, restricts drawing to the tiles whose bit is set.
+ * @note Animated tiles are rendered at their current frame.
+*/
+void IngameMapHandler::renderChunkTilelayers(Data_Chunk const& chunk, bool isGrayscale, Data_Chunk::TileMask const* mask) const {
+    constexpr int N = config::interface::mapChunkTileCount;
+    const auto tileRect = getTileRect(chunk);
+
+    const auto index = static_cast<std::size_t>(tileRect.y / N * mChunkCount.x + tileRect.x / N);
+    if (index >= level::data.drawLists.size()) return;
+
+    auto const& layers = level::data.drawLists[index];
+    for (int layer = 0; layer < static_cast<int>(layers.size()); ++layer) {
+        for (auto const& draw : layers[layer]) {
+            const SDL_Point tileCoords = { draw.tileCoords.x - tileRect.x, draw.tileCoords.y - tileRect.y };
+            if (mask != nullptr && !mask->test(tileCoords.y * N + tileCoords.x)) continue;
+
+            auto const& tileset = *draw.tileset;
+            auto gid = resolveAnimatedTile(draw.gid);
+            SDL_Rect srcRect = draw.srcRect;
+
+            if (gid != draw.gid) srcRect = tileset.getSrcRect(gid, isGrayscale);
+            else if (isGrayscale) {
+                srcRect.x += tileset.grayscale.origin.x - tileset.srcOrigin.x;
+                srcRect.y += tileset.grayscale.origin.y - tileset.srcOrigin.y;
+            }
+
+            globals::batch.draw(isGrayscale ? tileset.grayscale.texture : tileset.texture, srcRect, { tileCoords.x * level::data.tileDestSize.x, tileCoords.y * level::data.tileDestSize.y, level::data.tileDestSize.x, level::data.tileDestSize.y }, layer);
+        }
+    }
 }
 
 
@@ -10,23 +10,32 @@
 
 IngameViewHandler::IngameViewHandler(std::function<void()> const& callable, SDL_Rect& targetedEntityDestRect) : AbstractInterface<IngameViewHandler>(), kRenderMethod(callable), mTargetedEntityDestRect(targetedEntityDestRect) {}
 
+/**
+ * @brief Render dependencies directly to the window, in camera space.
+ * @note Dependencies project their level coordinates through `level::camera` and skip whatever falls outside of its viewport, hence fill cost scales with the size of the window rather than that of the level.
+ * @note Dependencies queue their sprites into `globals::batch`, either directly or sorted via `globals::renderQueue`. Both are flushed once all of them are queued.
+*/
 void IngameViewHandler::render() const {
-    // Focus on player entity
-    // auto cachedRenderTarget = SDL_GetRenderTarget(globals::renderer);
-    SDL_Texture* cachedRenderTarget = nullptr;
-    SDL_SetRenderTarget(globals::renderer, mTexture);
+    calculateViewport();
 
     // Render dependencies
     std::invoke(kRenderMethod);
+    globals::renderQueue.flush(globals::batch, config::batch::entityLayer);
+    globals::batch.flush(globals::renderer);
+}
 
+/**
+ * @brief Calculate the rendered portion and assign `level::camera` accordingly. Called prior to rendering dependencies.
+*/
+void IngameViewHandler::calculateViewport() const {
     switch (mView) {
         case View::kFullScreen:
-            SDL_SetRenderTarget(globals::renderer, cachedRenderTarget);
-            SDL_RenderCopy(globals::renderer, mTexture, nullptr, &mDestRect);
+            level::camera.viewport = { 0, 0, mTextureSize.x, mTextureSize.y };
+            level::camera.destRect = mDestRect;
             break;
 
         case View::kTargetEntity:
-            // Calculate rendered portion
+            // Focus on player entity
             mViewport.x = mTargetedEntityDestRect.x + (mTargetedEntityDestRect.w - mViewport.w) / 2;
             mViewport.y = mTargetedEntityDestRect.y + (mTargetedEntityDestRect.h - mViewport.h) / 2;
 
@@ -36,8 +45,8 @@ void IngameViewHandler::render() const {
             if (mViewport.y < 0) mViewport.y = 0;
             else if (mViewport.y + mViewport.h > mTextureSize.y) mViewport.y = mTextureSize.y - mViewport.h;
 
-            SDL_SetRenderTarget(globals::renderer, cachedRenderTarget);
-            SDL_RenderCopy(globals::renderer, mTexture, &mViewport, nullptr);
+            level::camera.viewport = mViewport;
+            level::camera.destRect = { 0, 0, globals::windowSize.x, globals::windowSize.y };
             break;
     }
 }
@@ -69,12 +78,10 @@ void IngameViewHandler::onWindowChange() {
 }
 
 void IngameViewHandler::onLevelChange() {
-    if (mTexture != nullptr) SDL_DestroyTexture(mTexture);
     mTextureSize = {
         level::data.tileDestCount.x * level::data.tileDestSize.x,
         level::data.tileDestCount.y * level::data.tileDestSize.y,
-    };
-    mTexture = SDL_CreateTexture(globals::renderer, SDL_PixelFormatEnum::SDL_PIXELFORMAT_RGBA32, SDL_TextureAccess::SDL_TEXTUREACCESS_TARGET, mTextureSize.x, mTextureSize.y);
+    };   // No intermediate render target, merely the size of the level
     
     mTileCountHeight = level::data.viewportHeight;
     onWindowChange();
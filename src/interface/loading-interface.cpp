@@ -24,8 +24,8 @@ void LoadingInterface::render() const {
 }
 
 void LoadingInterface::renderBackground() const {
-    utils::setRendererDrawColor(globals::renderer, config::color::offblack);
-    SDL_RenderFillRect(globals::renderer, nullptr);
+    globals::renderCommands.setRenderDrawColor(config::color::offblack);
+    globals::renderCommands.renderFillRect();
 }
 
 void LoadingInterface::renderComponents() const {
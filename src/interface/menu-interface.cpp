@@ -44,8 +44,8 @@ void MenuInterface::render() const {
  * @note In future commits, this method will take advantage of `texture`.
 */
 void MenuInterface::renderBackground() const {
-    utils::setRendererDrawColor(globals::renderer, config::color::offblack);
-    SDL_RenderFillRect(globals::renderer, nullptr);
+    globals::renderCommands.setRenderDrawColor(config::color::offblack);
+    globals::renderCommands.renderFillRect();
 }
 
 void MenuInterface::renderComponents() const {
@@ -18,7 +18,7 @@ AbstractInterface<T>::~AbstractInterface() {
 
 template <typename T>
 void AbstractInterface<T>::render() const {
-    SDL_RenderCopy(globals::renderer, mTexture, nullptr, nullptr);
+    globals::renderCommands.renderCopy(mTexture);
 }
 
 template <typename T>
@@ -0,0 +1,36 @@
+#include <timers.hpp>
+
+#include <functional>
+
+
+CountdownTimer::CountdownTimer(unsigned int maxTicks, std::function<void()> callback) : mMaxTicks(maxTicks) {
+    mNode.callback = std::move(callback);
+}
+
+CountdownTimer::~CountdownTimer() {
+    globals::wheel.cancel(mNode);
+}
+
+/**
+ * @note This method can also be used to restart the timer.
+*/
+void CountdownTimer::start() {
+    mIsStarted = true;
+    mStartTicks = globals::wheel.getTicks();
+    globals::wheel.schedule(mNode, mStartTicks + mMaxTicks);
+}
+
+void CountdownTimer::stop() {
+    mIsStarted = false;
+    globals::wheel.cancel(mNode);
+    mNode.isExpired = false;
+}
+
+/**
+ * @note If the timer is running, its expiry is re-evaluated relative to when it was started.
+*/
+void CountdownTimer::setMaxTicks(unsigned int maxTicks) {
+    if (mMaxTicks == maxTicks) return;
+    mMaxTicks = maxTicks;
+    if (mIsStarted) globals::wheel.schedule(mNode, mStartTicks + mMaxTicks);
+}
@@ -3,7 +3,10 @@
 #include <SDL_timer.h>
 
 
+/**
+ * @note Requires a live clock read, since the snapshot of `globals::frameClock` is taken at the start of the frame.
+*/
 void FPSControlTimer::controlFPS() {
-    auto ticks = getTicks();
+    auto ticks = static_cast<unsigned int>(globals::frameClock.getElapsedRealTicks());
     if (ticks < kTicksPerFrame) SDL_Delay(kTicksPerFrame - ticks);
 }
\ No newline at end of file
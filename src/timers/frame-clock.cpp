@@ -0,0 +1,69 @@
+#include <timers.hpp>
+
+#include <functional>
+
+#include <SDL_timer.h>
+
+
+/**
+ * @brief Take the snapshot for the current frame.
+ * @note Recommended implementation: this method should be called exactly once, at the start of every frame.
+*/
+void FrameClock::tick() {
+    auto counter = sample();
+    if (!mIsSampled) {
+        mPrevCounter = counter;
+        mIsSampled = true;
+    }
+
+    auto realDeltaTicks = (counter - mPrevCounter) * 1000.0 / getFrequency();
+    mPrevCounter = counter;
+
+    mRealTicks += realDeltaTicks;
+    mDeltaTicks = mIsPaused ? 0 : realDeltaTicks * mScale;
+    mTicks += mDeltaTicks;
+}
+
+/**
+ * @param source returns a monotonic counter, ticking `frequency` times per second.
+*/
+void FrameClock::setSource(Source source, Uint64 frequency) {
+    mSource = std::move(source);
+    mFrequency = frequency;
+    mIsSampled = false;   // The new counter is unrelated to the previous one
+}
+
+void FrameClock::resetSource() {
+    setSource(nullptr, 0);
+}
+
+void FrameClock::setScale(double scale) {
+    mScale = scale > 0 ? scale : 0;
+}
+
+void FrameClock::pause() {
+    mIsPaused = true;
+}
+
+void FrameClock::unpause() {
+    mIsPaused = false;
+}
+
+/**
+ * @return The real ticks elapsed since the latest snapshot. Performs a clock read, hence should be reserved for frame pacing.
+*/
+double FrameClock::getElapsedRealTicks() const {
+    return mIsSampled ? (sample() - mPrevCounter) * 1000.0 / getFrequency() : 0;
+}
+
+Uint64 FrameClock::sample() const {
+    return mSource ? mSource() : SDL_GetPerformanceCounter();
+}
+
+Uint64 FrameClock::getFrequency() const {
+    static const Uint64 frequency = SDL_GetPerformanceFrequency();
+    return mSource && mFrequency ? mFrequency : frequency;
+}
+
+
+FrameClock globals::frameClock;
@@ -0,0 +1,112 @@
+#include <timers.hpp>
+
+#include <mutex>
+
+
+/**
+ * @brief Schedule `node` to expire at `expiryTicks`. Reschedule if already scheduled.
+ * @note Nodes already due expire immediately.
+*/
+void TimingWheel::schedule(Data_Node& node, unsigned int expiryTicks) {
+    std::lock_guard<std::recursive_mutex> lock(mMutex);
+    cancel(node);
+
+    node.isExpired = false;
+    node.expiryTicks = expiryTicks;
+
+    if (static_cast<int>(expiryTicks - mTicks) <= 0) {
+        expire(node);
+        return;
+    }
+
+    insert(node);
+    ++mSize;
+}
+
+void TimingWheel::cancel(Data_Node& node) {
+    std::lock_guard<std::recursive_mutex> lock(mMutex);
+    if (!node.isScheduled()) return;
+
+    if (node.prev != nullptr) node.prev->next = node.next; else *node.slot = node.next;
+    if (node.next != nullptr) node.next->prev = node.prev;
+
+    node.prev = node.next = nullptr;
+    node.slot = nullptr;
+    --mSize;
+}
+
+/**
+ * @brief Process every tick elapsed since the previous call, up to the current snapshot of `globals::frameClock`.
+ * @note Recommended implementation: this method should be called once per frame, after `FrameClock::tick()` and prior to anything that might start or poll a timer.
+*/
+void TimingWheel::advance() {
+    advance(globals::frameClock.getTicks());
+}
+
+void TimingWheel::advance(unsigned int ticks) {
+    std::lock_guard<std::recursive_mutex> lock(mMutex);
+    while (static_cast<int>(ticks - mTicks) > 0) {
+        if (!mSize) {
+            mTicks = ticks;   // Nothing to process, skip ahead
+            return;
+        }
+
+        ++mTicks;
+        auto index = mTicks & kSlotMask;
+
+        // Cascade higher levels whenever the lower one wraps around
+        if (!index) for (unsigned int level = 1; level < kLevelCount; ++level) {
+            cascade(level);
+            if ((mTicks >> (kLevelBits * level)) & kSlotMask) break;
+        }
+
+        while (auto node = mSlots[0][index]) {
+            cancel(*node);
+            expire(*node);
+        }
+    }
+}
+
+/**
+ * @note Does not alter `mSize`.
+*/
+void TimingWheel::insert(Data_Node& node) {
+    static constexpr unsigned int maxDelta = (1u << (kLevelBits * kLevelCount)) - 1;
+
+    auto delta = node.expiryTicks - mTicks;
+    auto expiryTicks = delta > maxDelta ? mTicks + maxDelta : node.expiryTicks;   // Clamp to the span of the highest level, re-evaluated upon cascading
+    if (delta > maxDelta) delta = maxDelta;
+
+    unsigned int level = 0;
+    while (level + 1 < kLevelCount && delta >> (kLevelBits * (level + 1))) ++level;
+
+    auto& slot = mSlots[level][(expiryTicks >> (kLevelBits * level)) & kSlotMask];
+    node.prev = nullptr;
+    node.next = slot;
+    node.slot = &slot;
+    if (slot != nullptr) slot->prev = &node;
+    slot = &node;
+}
+
+void TimingWheel::expire(Data_Node& node) {
+    node.isExpired = true;
+    if (node.callback) node.callback();
+}
+
+/**
+ * @brief Redistribute the current slot of `level` into lower levels.
+*/
+void TimingWheel::cascade(unsigned int level) {
+    auto& slot = mSlots[level][(mTicks >> (kLevelBits * level)) & kSlotMask];
+    auto node = slot;
+    slot = nullptr;
+
+    while (node != nullptr) {
+        auto next = node->next;
+        insert(*node);
+        node = next;
+    }
+}
+
+
+TimingWheel globals::wheel;
@@ -0,0 +1,115 @@
+#include <pixel-kernels.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+
+namespace {
+    constexpr std::size_t kMaxWidth = 8;   // Of AVX2, the widest backend
+    constexpr std::size_t kMaxTail = kMaxWidth * 2;
+    constexpr std::size_t kBodyLength = 1024;
+
+    // Within a `SDL_PIXELFORMAT_RGBA32` pixel, read as a native `std::uint32_t`
+    constexpr std::uint32_t kMaskA = SDL_BYTEORDER == SDL_LIL_ENDIAN ? 0xff000000u : 0x000000ffu;
+    constexpr std::uint32_t kMaskRGB = ~kMaskA;
+
+    using Kernel = std::function<void(std::uint32_t*, std::size_t)>;
+
+    std::mt19937 rng(8964);
+    std::size_t failureCount = 0;
+
+    std::vector<std::uint32_t> makePixels(std::size_t count) {
+        std::vector<std::uint32_t> pixels(count);
+        for (auto& pixel : pixels) pixel = rng();
+        return pixels;
+    }
+
+    /**
+     * @brief Pixels drawn from a palette of `key` and near misses, with random alphas, so that color keys actually match.
+    */
+    std::vector<std::uint32_t> makeKeyedPixels(std::size_t count, std::uint32_t key) {
+        const std::uint32_t palette[] = { key, key ^ 0x01010101u, key ^ 0x80000080u, ~key };
+
+        std::vector<std::uint32_t> pixels(count);
+        for (auto& pixel : pixels) pixel = (palette[rng() % 4] & kMaskRGB) | (rng() & kMaskA);
+        return pixels;
+    }
+
+    void compare(const char* kernelName, pixel::Backend backend, std::vector<std::uint32_t> const& input, std::size_t offset, Kernel const& kernel) {
+        auto expected = input, actual = input;
+
+        pixel::setBackend(pixel::Backend::kScalar);
+        kernel(expected.data() + offset, expected.size() - offset);
+        pixel::setBackend(backend);
+        kernel(actual.data() + offset, actual.size() - offset);
+
+        for (std::size_t index = 0; index < input.size(); ++index) {
+            if (expected[index] == actual[index]) continue;
+
+            std::printf("FAIL %s [%s] span %zu at offset %zu: pixel %zu is 0x%08x, expected 0x%08x\n", kernelName, pixel::getBackendName(backend), input.size() - offset, offset, index, actual[index], expected[index]);
+            ++failureCount;
+            return;
+        }
+    }
+
+    /**
+     * @brief Run `kernel` over every span length and offset, with random pixels from `generate`.
+    */
+    void compareSpans(const char* kernelName, pixel::Backend backend, std::function<std::vector<std::uint32_t>(std::size_t)> const& generate, Kernel const& kernel) {
+        for (std::size_t offset = 0; offset < kMaxWidth; ++offset) {
+            for (std::size_t tail = 0; tail <= kMaxTail; ++tail) {
+                compare(kernelName, backend, generate(offset + tail), offset, kernel);
+                compare(kernelName, backend, generate(offset + kBodyLength + tail), offset, kernel);
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief Check every backend supported by the CPU against `Backend::kScalar`, kernel by kernel, over random spans.
+ * @note Span lengths cover every tail length up to twice the widest vector, both on their own and past a full-width body. Spans start at every offset within a vector, hence unaligned loads are exercised too.
+ * @return `0` if every backend matches bit for bit.
+*/
+int main() {
+    const auto selectedBackend = pixel::getBackend();
+
+    for (auto backend : pixel::getSupportedBackends()) {
+        if (backend == pixel::Backend::kScalar) continue;
+
+        for (unsigned int intensity = 0; intensity <= 256; ++intensity) {
+            compareSpans("grayscale", backend, makePixels, [=](std::uint32_t* pixels, std::size_t count) { pixel::grayscale(pixels, count, intensity); });
+        }
+
+        for (int iteration = 0; iteration < 64; ++iteration) {
+            const SDL_Color color = { static_cast<Uint8>(rng()), static_cast<Uint8>(rng()), static_cast<Uint8>(rng()), static_cast<Uint8>(rng()) };
+            compareSpans("tint", backend, makePixels, [=](std::uint32_t* pixels, std::size_t count) { pixel::tint(pixels, count, color); });
+        }
+        for (auto color : { SDL_Color{ 0, 0, 0, 0 }, SDL_Color{ 0xff, 0xff, 0xff, 0xff } }) {
+            compareSpans("tint", backend, makePixels, [=](std::uint32_t* pixels, std::size_t count) { pixel::tint(pixels, count, color); });
+        }
+
+        compareSpans("premultiplyAlpha", backend, makePixels, [](std::uint32_t* pixels, std::size_t count) { pixel::premultiplyAlpha(pixels, count); });
+
+        for (int iteration = 0; iteration < 64; ++iteration) {
+            const SDL_Color key = { static_cast<Uint8>(rng()), static_cast<Uint8>(rng()), static_cast<Uint8>(rng()), SDL_ALPHA_OPAQUE };
+            const std::uint32_t nativeKey = SDL_BYTEORDER == SDL_LIL_ENDIAN
+                ? static_cast<std::uint32_t>(key.r) | static_cast<std::uint32_t>(key.g) << 8 | static_cast<std::uint32_t>(key.b) << 16
+                : static_cast<std::uint32_t>(key.r) << 24 | static_cast<std::uint32_t>(key.g) << 16 | static_cast<std::uint32_t>(key.b) << 8;
+
+            compareSpans("colorKey", backend, [=](std::size_t count) { return makeKeyedPixels(count, nativeKey); }, [=](std::uint32_t* pixels, std::size_t count) { pixel::colorKey(pixels, count, key); });
+        }
+    }
+
+    pixel::setBackend(selectedBackend);
+
+    std::printf("%s: %zu failure(s) across", failureCount ? "FAILED" : "PASSED", failureCount);
+    for (auto backend : pixel::getSupportedBackends()) std::printf(" %s", pixel::getBackendName(backend));
+    std::printf("\n");
+
+    return failureCount ? 1 : 0;
+}